@@ -0,0 +1,59 @@
+#include <resultpp.hxx>
+
+#include <cstdio>
+#include <string>
+
+#include "harness.hxx"
+
+using resultpp::bench::DoNotOptimize;
+using resultpp::bench::Measure;
+using resultpp::bench::Report;
+
+namespace {
+    constexpr std::uint64_t kIterations = 2'000'000;
+    constexpr std::uint64_t kCaptureIterations = 200'000;
+    constexpr int kDepth = 8;
+
+    [[gnu::noinline]] resultpp::Result<int> Fail(int depth) {
+        if (depth > 0) return Fail(depth - 1);
+        return {0, std::string("io: short read")};
+    }
+
+    bool OnlyTimeouts(const std::string &message) { return message.rfind("timeout", 0) == 0; }
+}// namespace
+
+int main() {
+    resultpp::SetBacktraceSampling(0);
+    auto off = Measure("Err, sampling disabled", kIterations, [](auto) { DoNotOptimize(Fail(kDepth)); });
+    Report(off);
+
+    resultpp::SetBacktraceSampling(1'000'000);
+    auto skip = Measure("Err, sampling 1/1000000 (skip path)", kIterations, [](auto) { DoNotOptimize(Fail(kDepth)); });
+    Report(skip);
+
+    resultpp::SetBacktraceSampling(0);
+    resultpp::SetBacktraceFilter(&OnlyTimeouts);
+    auto filtered = Measure("Err, filter set, not selected", kIterations, [](auto) { DoNotOptimize(Fail(kDepth)); });
+    Report(filtered);
+    resultpp::SetBacktraceFilter(nullptr);
+
+    resultpp::SetBacktraceSampling(100);
+    auto sampled = Measure("Err, sampling 1/100", kIterations, [](auto) { DoNotOptimize(Fail(kDepth)); });
+    Report(sampled);
+
+    resultpp::SetBacktraceSampling(1);
+    auto all = Measure("Err, sampling 1/1 (capture every error)", kCaptureIterations, [](auto) { DoNotOptimize(Fail(kDepth)); });
+    Report(all);
+
+    std::printf("\nskip path overhead:      %8.2f ns/error\n", skip.nsPerOp - off.nsPerOp);
+    std::printf("cost per captured error: %8.2f ns/error\n", all.nsPerOp - off.nsPerOp);
+    std::printf("captured %llu of %llu errors on this thread\n\n",
+                static_cast<unsigned long long>(resultpp::BacktracesCaptured()),
+                static_cast<unsigned long long>(resultpp::ErrorsSeen()));
+
+    resultpp::SetBacktraceSampling(0);
+    resultpp::ClearBacktraces();
+    resultpp::CaptureBacktrace("example dump");
+    resultpp::DumpBacktraces(stdout);
+    return 0;
+}
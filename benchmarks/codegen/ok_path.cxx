@@ -0,0 +1,54 @@
+// Snippets whose Ok path must compile to a test and a branch. Each `codegen:` line is checked by
+// benchmarks/codegen_check.cmake against the hot part of the named function (the `.cold` split is ignored):
+//
+//   codegen: <function> <al|eax|rax|void> [tail-call target allowed on the Ok path]
+//
+// The Ok path may not call anything, allocate, or touch the stack, and must leave the result in the given register.
+#include <resultpp.hxx>
+
+using resultpp::Result;
+
+extern "C" void use(int value);
+
+// codegen: OkPathData eax
+extern "C" int OkPathData(const Result<int> &r) {
+    if (r.IsOk()) return r.Data();
+    return -1;
+}
+
+// codegen: OkPathUse void use
+extern "C" void OkPathUse(const Result<int> &r) {
+    if (r.IsOk()) use(r.Data());
+}
+
+// codegen: OkPathUnwrap eax
+extern "C" int OkPathUnwrap(const Result<int> &r) { return r.Unwrap(); }
+
+// codegen: OkPathIsErr al
+extern "C" bool OkPathIsErr(const Result<long> &r) { return r.IsErr(); }
+
+// codegen: OkPathMap rax
+extern "C" long OkPathMap(const Result<int> &r) {
+    auto mapped = r.Map([](const int &value) { return static_cast<long>(value) * 2; });
+    return mapped.IsOk() ? mapped.Data() : 0;
+}
+
+// codegen: OkPathFlatMap eax
+extern "C" int OkPathFlatMap(const Result<int> &r) {
+    auto next = r.FlatMap([](const int &value) { return Result<int>(value + 1); });
+    return next.IsOk() ? next.Data() : 0;
+}
+
+// codegen: OkPathPointer rax
+extern "C" const int *OkPathPointer(const Result<const int *> &r) { return r.IsOk() ? r.Data() : nullptr; }
+
+// codegen: OkPathLazyChain eax
+extern "C" int OkPathLazyChain(const Result<int> &r) {
+    auto chained = r.Lazy()
+                           .Map([](const int &value) { return value * 3; })
+                           .AndThen([](int value) { return value + 1; })
+                           .Map([](int value) { return value ^ 0x55; })
+                           .FlatMap([](int value) { return Result<int>(value - 1); })
+                           .Eval();
+    return chained.IsOk() ? chained.Data() : 0;
+}
@@ -0,0 +1,108 @@
+# Compiles a snippet TU and checks instruction-level properties of its Ok paths with objdump.
+#
+#   cmake -DCXX=<compiler> -DOBJDUMP=<objdump> -DINCLUDE_DIR=<lib> -DSTANDARD=17 -DWORK_DIR=<dir> \
+#         -DSOURCE=snippet.cxx [-DOPT=-O2] [-DDEFINES=A,B=1] -P codegen_check.cmake
+#
+# Every `// codegen: <function> <al|eax|rax|void> [tail-call targets...]` line in SOURCE names an `extern "C"` function
+# to check. Only the hot part of the function is inspected; the `<function>.cold` split that the compiler moves to
+# .text.unlikely is the Err path and may do anything. The hot part must not:
+#   - call anything, or tail-call anything but the listed targets,
+#   - reference an allocation or deallocation function,
+#   - adjust the stack pointer or spill to it,
+# and, unless `void`, must write its result to the given return register.
+# Fails with the offending disassembly when any check is violated.
+cmake_minimum_required(VERSION 3.23)
+
+if (NOT STANDARD)
+	set(STANDARD 17)
+endif ()
+if (NOT OPT)
+	set(OPT -O2)
+endif ()
+
+string(REPLACE "," ";" DEFINES "${DEFINES}")
+
+set(flags -std=c++${STANDARD} ${OPT} -I${INCLUDE_DIR})
+foreach (define IN LISTS DEFINES)
+	list(APPEND flags -D${define})
+endforeach ()
+
+get_filename_component(name ${SOURCE} NAME_WE)
+string(MAKE_C_IDENTIFIER "${name}${OPT}${DEFINES}" tag)
+set(object ${WORK_DIR}/codegen_${tag}.o)
+
+execute_process(COMMAND ${CXX} ${flags} -c ${SOURCE} -o ${object} RESULT_VARIABLE rc ERROR_VARIABLE errors)
+if (NOT rc EQUAL 0)
+	message(FATAL_ERROR "failed to compile ${SOURCE}:\n${errors}")
+endif ()
+
+execute_process(COMMAND ${OBJDUMP} -dr --no-show-raw-insn ${object} OUTPUT_VARIABLE disassembly RESULT_VARIABLE rc)
+if (NOT rc EQUAL 0)
+	message(FATAL_ERROR "failed to disassemble ${object}")
+endif ()
+
+set(heap_symbols "malloc|calloc|realloc|free|aligned_alloc|posix_memalign|_Znw|_Zna|_Zdl|_Zda")
+
+file(STRINGS ${SOURCE} checks REGEX "^// codegen: [A-Za-z_]")
+if (NOT checks)
+	message(FATAL_ERROR "${SOURCE} has no `// codegen:` lines")
+endif ()
+
+set(failures 0)
+foreach (check IN LISTS checks)
+	string(REGEX REPLACE "^// codegen: " "" check "${check}")
+	string(REPLACE " " ";" check "${check}")
+	list(POP_FRONT check function register)
+	set(tail_calls ${check})
+
+	# The body runs from the `<function>:` label to the blank line ending the symbol.
+	string(FIND "${disassembly}" "<${function}>:\n" begin)
+	if (begin EQUAL -1)
+		message(SEND_ERROR "${function}: not found in ${object}")
+		math(EXPR failures "${failures} + 1")
+		continue ()
+	endif ()
+	string(SUBSTRING "${disassembly}" ${begin} -1 body)
+	string(FIND "${body}" "\n\n" end)
+	if (NOT end EQUAL -1)
+		string(SUBSTRING "${body}" 0 ${end} body)
+	endif ()
+
+	set(problems "")
+	string(REGEX MATCHALL "\t(call|jmp) +[^\n]*(\n\t\t\t[^\n]*R_X86_64_[^\n]*)?" branches "${body}")
+	foreach (branch IN LISTS branches)
+		if (branch MATCHES "R_X86_64_[A-Z0-9_]+\t([^\n+-]+)")
+			set(target ${CMAKE_MATCH_1})
+		elseif (branch MATCHES "<([^>+]+)")
+			set(target ${CMAKE_MATCH_1})
+		else ()
+			set(target "*indirect*")
+		endif ()
+		if (branch MATCHES "^\tcall")
+			list(APPEND problems "calls ${target}")
+		elseif (NOT target STREQUAL function AND NOT target MATCHES "^\\.text" AND NOT target IN_LIST tail_calls)
+			list(APPEND problems "tail-calls ${target}")
+		endif ()
+	endforeach ()
+	if (body MATCHES "R_X86_64_[A-Z0-9_]+\t(${heap_symbols})[^\n]*")
+		list(APPEND problems "references ${CMAKE_MATCH_1}")
+	endif ()
+	if (body MATCHES "\tpush " OR body MATCHES ",%rsp\n" OR body MATCHES "\\(%rsp\\)")
+		list(APPEND problems "uses the stack")
+	endif ()
+	if (NOT register STREQUAL "void" AND NOT body MATCHES "[ ,]%${register}\n")
+		list(APPEND problems "does not return in %${register}")
+	endif ()
+
+	if (problems)
+		list(JOIN problems ", " problems)
+		message(SEND_ERROR "${function} (${OPT}): Ok path ${problems}\n${body}\n")
+		math(EXPR failures "${failures} + 1")
+	else ()
+		message("  ${function} (${OPT}): ok")
+	endif ()
+endforeach ()
+
+if (failures GREATER 0)
+	message(FATAL_ERROR "${failures} Ok path(s) in ${SOURCE} regressed")
+endif ()
@@ -0,0 +1,22 @@
+// Throughput of the Ok path when the error side is outlined into cold helpers. Built twice: as bench_cold_paths,
+// and with RESULTPP_NO_COLD_PATHS as bench_cold_paths_inline, where the error side is inlined next to the hot code.
+#include "cold_steps.hxx"
+#include "runner.hxx"
+
+using resultpp::bench::DoNotOptimize;
+using resultpp::bench::kStepTable;
+using resultpp::bench::Runner;
+using resultpp::bench::Section;
+
+int main(int argc, const char **argv) {
+    Runner runner(argc, argv);
+
+#if defined(RESULTPP_NO_COLD_PATHS)
+    Section("error side inlined (RESULTPP_NO_COLD_PATHS)");
+#else
+    Section("error side outlined to cold helpers");
+#endif
+    runner.Run("one instantiation (fits in L1i)", [](std::uint64_t) { DoNotOptimize(kStepTable[0]()); });
+    runner.Run("256 instantiations round-robin", [](std::uint64_t i) { DoNotOptimize(kStepTable[i % kStepTable.size()]()); });
+    return runner.Finish();
+}
@@ -0,0 +1,46 @@
+#ifndef RESULTPP_BENCHMARKS_COLD_STEPS_HXX
+#define RESULTPP_BENCHMARKS_COLD_STEPS_HXX
+
+#include <resultpp.hxx>
+
+#include <array>   // std::array
+#include <cstddef> // std::size_t
+#include <utility> // std::index_sequence
+
+namespace resultpp::bench {
+    /**
+     * @brief Distinct payload types, so every step is a separate instantiation with its own code.
+     */
+    template<int N>
+    struct Payload {
+        int value;
+    };
+
+    template<int N>
+    const Result<Payload<N>> kStepInput{Payload<N>{N}};
+
+    /**
+     * @brief A hot path touching the combinators and accessors that have an error side.
+     */
+    template<int N>
+    [[gnu::noinline]] int Step(const Result<Payload<N>> &r) {
+        auto mapped = r.Map([](const Payload<N> &p) { return p.value + 1; });
+        auto flat = mapped.FlatMap([](const int &v) { return Result<long>(v * 2L); });
+        return static_cast<int>(flat.Unwrap()) + r.Expect("missing payload").value;
+    }
+
+    template<int N>
+    int RunStep() { return Step<N>(kStepInput<N>); }
+
+    using StepFn = int (*)();
+
+    template<int... N>
+    constexpr auto MakeSteps(std::integer_sequence<int, N...>) {
+        return std::array<StepFn, sizeof...(N)>{&RunStep<N>...};
+    }
+
+    inline constexpr std::size_t kSteps = 256;
+    inline constexpr auto kStepTable = MakeSteps(std::make_integer_sequence<int, static_cast<int>(kSteps)>());
+}// namespace resultpp::bench
+
+#endif//RESULTPP_BENCHMARKS_COLD_STEPS_HXX
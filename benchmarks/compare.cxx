@@ -0,0 +1,259 @@
+#include <resultpp.hxx>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <variant>
+
+#if __has_include(<expected>)
+#include <expected>
+#endif
+
+#include "runner.hxx"
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#define RESULTPP_BENCH_EXPECTED 1
+#else
+#define RESULTPP_BENCH_EXPECTED 0
+#endif
+
+using resultpp::bench::DoNotOptimize;
+using resultpp::bench::Opaque;
+using resultpp::bench::Runner;
+using resultpp::bench::Section;
+
+namespace {
+    using Result = resultpp::Result<int>;
+
+    constexpr std::size_t kPatternSize = 4096;
+
+    /**
+     * @brief Pseudo-random failure pattern, so the branch predictor cannot learn the error path.
+     */
+    class Pattern {
+        std::array<bool, kPatternSize> _fail{};
+
+    public:
+        explicit Pattern(unsigned percent) {
+            std::uint32_t state = 0x9e3779b9U;
+            for (auto &fail : _fail) {
+                state = state * 1664525U + 1013904223U;
+                fail = (state >> 8U) % 100U < percent;
+            }
+        }
+
+        bool operator()(std::uint64_t i) const { return _fail[i % kPatternSize]; }
+    };
+
+    struct ResultPolicy {
+        using type = Result;
+        static constexpr const char *name = "Result";
+        static type Ok(int v) { return type(v); }
+        static type Err() { return type(0, std::string("failure")); }
+        static bool Failed(const type &r) { return r.IsErr(); }
+        static int Value(const type &r) { return r.Data(); }
+    };
+
+    struct OptionalPolicy {
+        using type = std::optional<int>;
+        static constexpr const char *name = "std::optional";
+        static type Ok(int v) { return v; }
+        static type Err() { return std::nullopt; }
+        static bool Failed(const type &r) { return !r.has_value(); }
+        static int Value(const type &r) { return *r; }
+    };
+
+    struct VariantPolicy {
+        using type = std::variant<int, std::string>;
+        static constexpr const char *name = "std::variant";
+        static type Ok(int v) { return type(std::in_place_index<0>, v); }
+        static type Err() { return type(std::in_place_index<1>, "failure"); }
+        static bool Failed(const type &r) { return r.index() != 0; }
+        static int Value(const type &r) { return *std::get_if<0>(&r); }
+    };
+
+#if RESULTPP_BENCH_EXPECTED
+    struct ExpectedPolicy {
+        using type = std::expected<int, std::string>;
+        static constexpr const char *name = "std::expected";
+        static type Ok(int v) { return v; }
+        static type Err() { return std::unexpected<std::string>("failure"); }
+        static bool Failed(const type &r) { return !r.has_value(); }
+        static int Value(const type &r) { return *r; }
+    };
+#endif
+
+    template<typename P>
+    [[gnu::noinline]] typename P::type Leaf(bool fail, int v) {
+        if (fail) return P::Err();
+        return P::Ok(v);
+    }
+
+    template<typename P>
+    [[gnu::noinline]] typename P::type Chain(int depth, bool fail, int v) {
+        if (depth <= 1) return Leaf<P>(fail, v);
+        auto r = Chain<P>(depth - 1, fail, v);
+        if (P::Failed(r)) return r;
+        return P::Ok(P::Value(r) + 1);
+    }
+
+    [[gnu::noinline]] int ThrowLeaf(bool fail, int v) {
+        if (fail) throw std::runtime_error("failure");
+        return v;
+    }
+
+    [[gnu::noinline]] int ThrowChain(int depth, bool fail, int v) {
+        if (depth <= 1) return ThrowLeaf(fail, v);
+        return ThrowChain(depth - 1, fail, v) + 1;
+    }
+
+    std::string Label(const char *group, const char *mechanism, int depth, unsigned percent) {
+        return std::string(group) + " depth=" + std::to_string(depth) + " err=" + std::to_string(percent) + "% " + mechanism;
+    }
+
+    template<typename P>
+    void Construction(Runner &runner) {
+        runner.Run(std::string("construct Ok  ") + P::name, [](std::uint64_t i) {
+            DoNotOptimize(P::Ok(static_cast<int>(i)));
+        });
+        runner.Run(std::string("construct Err ") + P::name, [](std::uint64_t) {
+            DoNotOptimize(P::Err());
+        });
+    }
+
+    template<typename P>
+    void Propagation(Runner &runner, int depth, unsigned percent) {
+        Pattern pattern(percent);
+        runner.Run(Label("propagate", P::name, depth, percent), [&](std::uint64_t i) {
+            DoNotOptimize(Chain<P>(depth, pattern(i), static_cast<int>(i)));
+        });
+    }
+
+    void ThrowPropagation(Runner &runner, int depth, unsigned percent) {
+        Pattern pattern(percent);
+        runner.Run(Label("propagate", "exceptions", depth, percent), [&](std::uint64_t i) {
+            try {
+                DoNotOptimize(ThrowChain(depth, pattern(i), static_cast<int>(i)));
+            } catch (const std::runtime_error &e) {
+                DoNotOptimize(e);
+            }
+        });
+    }
+
+    void Combinators(Runner &runner) {
+        static const Result ok(1);
+        static const Result err(0, std::string("failure"));
+        static const Result fallback(2);
+
+        for (const auto *input : {&ok, &err}) {
+            std::string suffix = input == &ok ? " (Ok input)" : " (Err input)";
+            runner.Run("Result::Map" + suffix, [&](std::uint64_t) {
+                DoNotOptimize(Opaque(input)->Map<int>([](const int &v) { return v + 1; }));
+            });
+            runner.Run("Result::AndThen" + suffix, [&](std::uint64_t) {
+                DoNotOptimize(Opaque(input)->AndThen<int>([](const int &v) { return v + 1; }));
+            });
+            runner.Run("Result::FlatMap" + suffix, [&](std::uint64_t) {
+                DoNotOptimize(Opaque(input)->FlatMap<int>([](const int &v) { return Result(v + 1); }));
+            });
+            runner.Run("Result::Or" + suffix, [&](std::uint64_t) {
+                DoNotOptimize(Opaque(input)->Or(fallback));
+            });
+            runner.Run("Result::OrElse" + suffix, [&](std::uint64_t) {
+                auto copy = *Opaque(input);
+                DoNotOptimize(copy.OrElse([](const std::string &) { return Result(2); }));
+            });
+        }
+
+        static const std::optional<int> optOk(1);
+        static const std::optional<int> optErr;
+#if defined(__cpp_lib_optional) && __cpp_lib_optional >= 202110L
+        for (const auto *input : {&optOk, &optErr}) {
+            std::string suffix = input == &optOk ? " (Ok input)" : " (Err input)";
+            runner.Run("std::optional::transform" + suffix, [&](std::uint64_t) {
+                DoNotOptimize(Opaque(input)->transform([](int v) { return v + 1; }));
+            });
+            runner.Run("std::optional::and_then" + suffix, [&](std::uint64_t) {
+                DoNotOptimize(Opaque(input)->and_then([](int v) { return std::optional<int>(v + 1); }));
+            });
+        }
+#else
+        DoNotOptimize(optOk);
+        DoNotOptimize(optErr);
+#endif
+
+#if RESULTPP_BENCH_EXPECTED && __cpp_lib_expected >= 202211L
+        static const std::expected<int, std::string> expOk(1);
+        static const std::expected<int, std::string> expErr(std::unexpect, "failure");
+        for (const auto *input : {&expOk, &expErr}) {
+            std::string suffix = input == &expOk ? " (Ok input)" : " (Err input)";
+            runner.Run("std::expected::transform" + suffix, [&](std::uint64_t) {
+                DoNotOptimize(Opaque(input)->transform([](int v) { return v + 1; }));
+            });
+            runner.Run("std::expected::and_then" + suffix, [&](std::uint64_t) {
+                DoNotOptimize(Opaque(input)->and_then([](int v) { return std::expected<int, std::string>(v + 1); }));
+            });
+        }
+#endif
+    }
+
+    void Unwrap(Runner &runner) {
+        static const Result ok(1);
+        static const Result err(0, std::string("failure"));
+        static const std::optional<int> optOk(1);
+        static const std::optional<int> optErr;
+
+        runner.Run("Result::Unwrap (Ok)", [&](std::uint64_t) { DoNotOptimize(Opaque(&ok)->Unwrap()); });
+        runner.Run("Result::Unwrap (Err, throws)", [&](std::uint64_t) {
+            try {
+                DoNotOptimize(Opaque(&err)->Unwrap());
+            } catch (const std::runtime_error &e) {
+                DoNotOptimize(e);
+            }
+        });
+        runner.Run("std::optional::value (Ok)", [&](std::uint64_t) { DoNotOptimize(Opaque(&optOk)->value()); });
+        runner.Run("std::optional::value (Err, throws)", [&](std::uint64_t) {
+            try {
+                DoNotOptimize(Opaque(&optErr)->value());
+            } catch (const std::bad_optional_access &e) {
+                DoNotOptimize(e);
+            }
+        });
+    }
+}// namespace
+
+int main(int argc, const char **argv) {
+    constexpr int kDepths[] = {1, 2, 4, 8, 16, 32};
+    constexpr unsigned kErrorRates[] = {0, 1, 10, 50, 100};
+    Runner runner(argc, argv);
+
+    Section("construction");
+    Construction<ResultPolicy>(runner);
+    Construction<OptionalPolicy>(runner);
+    Construction<VariantPolicy>(runner);
+#if RESULTPP_BENCH_EXPECTED
+    Construction<ExpectedPolicy>(runner);
+#endif
+
+    Section("propagation");
+    for (auto depth : kDepths) {
+        for (auto percent : kErrorRates) {
+            Propagation<ResultPolicy>(runner, depth, percent);
+            ThrowPropagation(runner, depth, percent);
+            Propagation<OptionalPolicy>(runner, depth, percent);
+            Propagation<VariantPolicy>(runner, depth, percent);
+#if RESULTPP_BENCH_EXPECTED
+            Propagation<ExpectedPolicy>(runner, depth, percent);
+#endif
+        }
+    }
+
+    Section("combinators");
+    Combinators(runner);
+
+    Section("unwrap");
+    Unwrap(runner);
+    return runner.Finish();
+}
@@ -0,0 +1,4 @@
+// Instantiates the 256 steps of cold_steps.hxx; .text divided by the step count is the code size per instantiation.
+#include "../cold_steps.hxx"
+
+int main(int argc, const char **) { return resultpp::bench::kStepTable[static_cast<std::size_t>(argc)](); }
@@ -0,0 +1,2 @@
+// Baseline translation unit: compiler start-up cost only.
+int main() { return 0; }
@@ -0,0 +1,8 @@
+// A typical user of the classic header.
+#include <resultpp.hxx>
+
+int main() {
+    resultpp::Result<int> r(1);
+    auto mapped = r.Map([](const int &v) { return v * 2; }).FlatMap([](const int &v) { return resultpp::Result<long>(v); });
+    return static_cast<int>(mapped.Data());
+}
@@ -0,0 +1,9 @@
+// The classic header together with <functional>, which it required before the combinators were templated.
+#include <functional>
+#include <resultpp.hxx>
+
+int main() {
+    resultpp::Result<int> r(1);
+    auto mapped = r.Map([](const int &v) { return v * 2; }).FlatMap([](const int &v) { return resultpp::Result<long>(v); });
+    return static_cast<int>(mapped.Data());
+}
@@ -0,0 +1,26 @@
+// Uses the members of ResultImpl<int> and ResultImpl<std::string> the way a typical TU does, to compare the
+// object size with implicit instantiation against `extern template` declarations from resultpp_instances.
+#include <resultpp.hxx>
+
+#include <string>
+
+resultpp::Result<int> ParsePort(const std::string &text) {
+    if (text.empty()) return {0, std::string("empty port")};
+    return std::stoi(text);
+}
+
+resultpp::Result<std::string> Describe(const resultpp::Result<int> &port) {
+    if (port.IsErr()) return {std::string(), port.Message()};
+    return std::to_string(port.Data());
+}
+
+int main(int argc, const char **argv) {
+    auto port = ParsePort(argc > 1 ? argv[1] : "8080");
+    resultpp::Result<int> copy;
+    copy = port;
+    copy << 80;
+    swap(copy, port);
+    auto text = Describe(port);
+    text.SetData("x");
+    return text == Describe(copy) ? port.Unwrap() : copy.Expect("no port");
+}
@@ -0,0 +1,83 @@
+# Measures the compile time and output size of single translation units.
+#
+#   cmake -DCXX=<compiler> -DINCLUDE_DIR=<lib> -DSTANDARD=17 -DREPEAT=10 -DWORK_DIR=<dir> \
+#         -DSOURCES=a.cxx,b.cxx [-DLABEL=name] [-DOPT=-O0] [-DDEFINES=A,B=1] [-DEXTRA_INCLUDE=<dir>] \
+#         [-DSIZE_TOOL=<size>] [-DDIVISOR=N] -P compile_time.cmake
+#
+# For each source, prints the mean wall time of REPEAT compilations, the size of the preprocessed translation unit,
+# the object size and, when SIZE_TOOL is given, the size of the hot .text and cold .text.unlikely sections, also divided by
+# DIVISOR when the TU holds DIVISOR instantiations of the code under test.
+cmake_minimum_required(VERSION 3.23)
+
+if (NOT REPEAT)
+	set(REPEAT 10)
+endif ()
+if (NOT STANDARD)
+	set(STANDARD 17)
+endif ()
+if (NOT OPT)
+	set(OPT -O0)
+endif ()
+
+string(REPLACE "," ";" SOURCES "${SOURCES}")
+string(REPLACE "," ";" DEFINES "${DEFINES}")
+
+set(flags -std=c++${STANDARD} ${OPT} -I${INCLUDE_DIR})
+if (EXTRA_INCLUDE)
+	list(APPEND flags -I${EXTRA_INCLUDE})
+endif ()
+foreach (define IN LISTS DEFINES)
+	list(APPEND flags -D${define})
+endforeach ()
+
+message("${LABEL} (${REPEAT} runs, -std=c++${STANDARD} ${OPT}):")
+
+foreach (source IN LISTS SOURCES)
+	get_filename_component(name ${source} NAME_WE)
+	set(object ${WORK_DIR}/${name}${LABEL}.o)
+	set(preprocessed ${WORK_DIR}/${name}${LABEL}.ii)
+
+	execute_process(COMMAND ${CXX} ${flags} -E ${source} -o ${preprocessed} RESULT_VARIABLE rc)
+	if (NOT rc EQUAL 0)
+		message(FATAL_ERROR "failed to preprocess ${source}")
+	endif ()
+	file(SIZE ${preprocessed} bytes)
+
+	set(total 0)
+	foreach (i RANGE 1 ${REPEAT})
+		string(TIMESTAMP start "%s%f")
+		execute_process(COMMAND ${CXX} ${flags} -c ${source} -o ${object} RESULT_VARIABLE rc)
+		string(TIMESTAMP stop "%s%f")
+		if (NOT rc EQUAL 0)
+			message(FATAL_ERROR "failed to compile ${source}")
+		endif ()
+		math(EXPR total "${total} + ${stop} - ${start}")
+	endforeach ()
+	file(SIZE ${object} object_bytes)
+
+	set(text "")
+	if (SIZE_TOOL)
+		execute_process(COMMAND ${SIZE_TOOL} -A ${object} OUTPUT_VARIABLE sections)
+		set(hot_bytes 0)
+		set(cold_bytes 0)
+		string(REGEX MATCHALL "\n\\.text[^ ]* +[0-9]+" text_lines "${sections}")
+		foreach (line IN LISTS text_lines)
+			string(REGEX MATCH "[0-9]+$" bytes_in_section "${line}")
+			if (line MATCHES "\\.text\\.unlikely")
+				math(EXPR cold_bytes "${cold_bytes} + ${bytes_in_section}")
+			else ()
+				math(EXPR hot_bytes "${hot_bytes} + ${bytes_in_section}")
+			endif ()
+		endforeach ()
+		set(text ", ${hot_bytes} B .text + ${cold_bytes} B .text.unlikely")
+		if (DIVISOR)
+			math(EXPR hot_per_unit "${hot_bytes} / ${DIVISOR}")
+			math(EXPR cold_per_unit "${cold_bytes} / ${DIVISOR}")
+			set(text "${text} (${hot_per_unit} + ${cold_per_unit} B per instantiation)")
+		endif ()
+	endif ()
+
+	math(EXPR mean_ms "${total} / ${REPEAT} / 1000")
+	math(EXPR kib "${bytes} / 1024")
+	message("  ${name}: ${mean_ms} ms, ${kib} KiB preprocessed, ${object_bytes} B object${text}")
+endforeach ()
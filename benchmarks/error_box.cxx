@@ -0,0 +1,130 @@
+// ErrorBox against std::any and std::exception_ptr as a container for "any error": boxing an error and reading it
+// back through a downcast, for an error that fits in an ErrorBox (16 bytes, too large for the in-place storage of
+// std::any in libstdc++) and one that does not (64 bytes), a downcast to the wrong type, and a failure propagated
+// through four frames as Result<int, ErrorBox> against formatting it into the Result<int> message.
+#include <ErrorBox.hxx>
+
+#include <any>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <type_traits>
+
+#include "runner.hxx"
+
+using resultpp::bench::DoNotOptimize;
+using resultpp::bench::Runner;
+using resultpp::bench::Section;
+
+namespace {
+    struct ParseError {
+        std::uint64_t line;
+        std::uint64_t column;
+    };
+
+    struct IoError {
+        std::uint64_t code;
+        char path[56];
+    };
+
+    struct OtherError {
+        int value;
+    };
+
+    template<typename E>
+    E Make(std::uint64_t i) {
+        E error{};
+        if constexpr (std::is_same_v<E, ParseError>) error.line = i;
+        else error.code = i;
+        return error;
+    }
+
+    template<typename E>
+    std::uint64_t Key(const E &error) {
+        if constexpr (std::is_same_v<E, ParseError>) return error.line;
+        else return error.code;
+    }
+
+    template<typename E>
+    void RunBoxes(Runner &runner, const char *size) {
+        runner.Run(std::string("ErrorBox, ") + size, [](std::uint64_t i) {
+            resultpp::ErrorBox box(Make<E>(i));
+            if (const auto *error = box.As<E>()) DoNotOptimize(Key(*error));
+        });
+        runner.Run(std::string("std::any, ") + size, [](std::uint64_t i) {
+            std::any box(Make<E>(i));
+            if (const auto *error = std::any_cast<E>(&box)) DoNotOptimize(Key(*error));
+        });
+        runner.Run(std::string("std::exception_ptr, ") + size, [](std::uint64_t i) {
+            auto box = std::make_exception_ptr(Make<E>(i));
+            try {
+                std::rethrow_exception(box);
+            } catch (const E &error) {
+                DoNotOptimize(Key(error));
+            }
+        });
+    }
+
+    using BoxResult = resultpp::Result<int, resultpp::ErrorBox>;
+    using StringResult = resultpp::Result<int>;
+
+    [[gnu::noinline]] BoxResult Parse(std::uint64_t i) {
+        if (i % 2 == 0) return BoxResult(0, ParseError{i, 7});
+        return BoxResult(static_cast<int>(i));
+    }
+
+    [[gnu::noinline]] StringResult ParseText(std::uint64_t i) {
+        if (i % 2 == 0) return StringResult(0, "parse error at " + std::to_string(i) + ":" + std::to_string(7));
+        return StringResult(static_cast<int>(i));
+    }
+
+    template<typename R, R (*Leaf)(std::uint64_t)>
+    [[gnu::noinline]] R Frame(std::uint64_t i, int depth) {
+        if (depth == 0) return Leaf(i);
+        auto result = Frame<R, Leaf>(i, depth - 1);
+        if (result.IsErr()) return result;
+        return R(result.Data() + 1);
+    }
+}// namespace
+
+int main(int argc, const char **argv) {
+    Runner runner(argc, argv);
+
+    Section("box an error and downcast it back");
+    RunBoxes<ParseError>(runner, "16-byte error");
+    RunBoxes<IoError>(runner, "64-byte error");
+
+    Section("downcast to a type that is not there");
+    runner.Run("ErrorBox::Is", [](std::uint64_t i) {
+        resultpp::ErrorBox box(ParseError{i, 0});
+        DoNotOptimize(box.Is<OtherError>());
+    });
+    runner.Run("std::any_cast", [](std::uint64_t i) {
+        std::any box(ParseError{i, 0});
+        DoNotOptimize(std::any_cast<OtherError>(&box));
+    });
+    runner.Run("std::rethrow_exception, catch (...)", [](std::uint64_t i) {
+        auto box = std::make_exception_ptr(ParseError{i, 0});
+        bool matched = false;
+        try {
+            std::rethrow_exception(box);
+        } catch (const OtherError &) {
+            matched = true;
+        } catch (...) {
+        }
+        DoNotOptimize(matched);
+    });
+
+    Section("propagate through 4 frames, 50% errors");
+    runner.Run("Result<int, ErrorBox>, read ParseError::line", [](std::uint64_t i) {
+        auto result = Frame<BoxResult, Parse>(i, 4);
+        if (const auto *error = result.Message().As<ParseError>()) DoNotOptimize(error->line);
+        else DoNotOptimize(result.Data());
+    });
+    runner.Run("Result<int>, formatted message", [](std::uint64_t i) {
+        auto result = Frame<StringResult, ParseText>(i, 4);
+        if (result.IsErr()) DoNotOptimize(result.Message().size());
+        else DoNotOptimize(result.Data());
+    });
+    return runner.Finish();
+}
@@ -0,0 +1,65 @@
+#include <ErrorSites.hxx>
+#include <resultpp.hxx>
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "runner.hxx"
+
+using resultpp::bench::DoNotOptimize;
+using resultpp::bench::Runner;
+using resultpp::bench::Section;
+using resultpp::bench::Unpin;
+
+namespace {
+    constexpr int kTimeout = 110;
+    constexpr int kNotFound = 2;
+
+    [[gnu::noinline]] resultpp::Result<int> Plain(std::uint64_t i) {
+        if (i % 4 == 0) return {0, std::string("timeout")};
+        return {0, std::string("not found")};
+    }
+
+    [[gnu::noinline]] resultpp::Result<int> Counted(std::uint64_t i) {
+        if (i % 4 == 0) return RESULTPP_ERR_CODE(kTimeout, "timeout");
+        return RESULTPP_ERR_CODE(kNotFound, "not found");
+    }
+
+    double Contended(unsigned threads, std::uint64_t perThread) {
+        std::vector<std::thread> workers;
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned t = 0; t < threads; ++t) {
+            workers.emplace_back([perThread] {
+                for (std::uint64_t i = 0; i < perThread; ++i) RESULTPP_COUNT_ERR(kTimeout);
+            });
+        }
+        for (auto &worker : workers) worker.join();
+        auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        return ns / static_cast<double>(perThread);
+    }
+}// namespace
+
+int main(int argc, const char **argv) {
+    Runner runner(argc, argv);
+
+    Section("single thread");
+    runner.Run("Err construction, uncounted", [](std::uint64_t i) { DoNotOptimize(Plain(i)); });
+    runner.Run("Err construction, RESULTPP_ERR_CODE", [](std::uint64_t i) { DoNotOptimize(Counted(i)); });
+    runner.Run("RESULTPP_COUNT_ERR only", [](std::uint64_t) {
+        RESULTPP_COUNT_ERR(kTimeout);
+        resultpp::bench::ClobberMemory();
+    });
+
+    Unpin();
+    Section("all threads incrementing one site");
+    auto cores = std::max(1U, std::thread::hardware_concurrency());
+    for (unsigned threads = 1; threads <= cores; threads *= 2) {
+        std::printf("%2u thread(s): %8.2f ns/increment per thread\n", threads, Contended(threads, 10'000'000));
+    }
+
+    Section("top sites");
+    resultpp::DumpTopErrorSites(stdout, 5);
+    return runner.Finish();
+}
@@ -0,0 +1,181 @@
+// Executor against a pool with one mutex-protected queue and a condition variable: the cost of the task objects,
+// throughput of tiny tasks posted from outside and spawned from inside the pool (fork-join), from one worker to all
+// cores, and the round-trip latency of Submit followed by Get.
+#include <Executor.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "runner.hxx"
+
+using resultpp::bench::DoNotOptimize;
+using resultpp::bench::Runner;
+using resultpp::bench::Section;
+using resultpp::bench::Unpin;
+
+namespace {
+    constexpr long kTasks = 200'000;
+    constexpr int kForkDepth = 17;
+    constexpr int kRoundTrips = 20'000;
+
+    /**
+     * @brief The textbook pool: one queue of std::function behind a mutex, idle workers on a condition variable.
+     */
+    class LockedPool {
+        std::mutex _mutex;
+        std::condition_variable _ready;
+        std::deque<std::function<void()>> _queue;
+        std::vector<std::thread> _threads;
+        bool _stopping = false;
+
+    public:
+        explicit LockedPool(unsigned workers) {
+            for (unsigned i = 0; i < workers; ++i) {
+                _threads.emplace_back([this] {
+                    for (;;) {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        _ready.wait(lock, [this] { return _stopping || !_queue.empty(); });
+                        if (_queue.empty()) return;
+                        auto work = std::move(_queue.front());
+                        _queue.pop_front();
+                        lock.unlock();
+                        work();
+                    }
+                });
+            }
+        }
+
+        ~LockedPool() {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+            _ready.notify_all();
+            for (auto &thread : _threads) thread.join();
+        }
+
+        template<typename F>
+        void Post(F &&work) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _queue.emplace_back(std::forward<F>(work));
+            }
+            _ready.notify_one();
+        }
+    };
+
+    void AwaitZero(const std::atomic<long> &remaining) {
+        while (remaining.load(std::memory_order_acquire) != 0) std::this_thread::yield();
+    }
+
+    template<typename Pool>
+    double PostedNs(unsigned workers) {
+        Pool pool(workers);
+        std::atomic<long> remaining{kTasks};
+        auto start = std::chrono::steady_clock::now();
+        for (long i = 0; i < kTasks; ++i) pool.Post([&remaining] { remaining.fetch_sub(1, std::memory_order_release); });
+        AwaitZero(remaining);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / kTasks;
+    }
+
+    /**
+     * @brief A binary tree of tasks, each leaf doing nothing but counting itself; 2^depth leaves.
+     */
+    template<typename Pool>
+    void Fork(Pool &pool, std::atomic<long> &remaining, int depth) {
+        if (depth == 0) {
+            remaining.fetch_sub(1, std::memory_order_release);
+            return;
+        }
+        pool.Post([&pool, &remaining, depth] { Fork(pool, remaining, depth - 1); });
+        pool.Post([&pool, &remaining, depth] { Fork(pool, remaining, depth - 1); });
+    }
+
+    template<typename Pool>
+    double ForkJoinNs(unsigned workers) {
+        Pool pool(workers);
+        std::atomic<long> remaining{1L << kForkDepth};
+        auto start = std::chrono::steady_clock::now();
+        pool.Post([&pool, &remaining] { Fork(pool, remaining, kForkDepth); });
+        AwaitZero(remaining);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / ((2L << kForkDepth) - 1);
+    }
+
+    /**
+     * @brief Median and 99th percentile of Submit-then-Get from a thread outside the pool, in nanoseconds.
+     */
+    std::pair<double, double> RoundTripNs(unsigned workers) {
+        resultpp::Executor executor(workers);
+        std::vector<double> samples;
+        samples.reserve(kRoundTrips);
+        for (int i = 0; i < kRoundTrips; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            DoNotOptimize(executor.Submit([i] { return i + 1; }).Get());
+            samples.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+        }
+        std::sort(samples.begin(), samples.end());
+        return {samples[samples.size() / 2], samples[samples.size() * 99 / 100]};
+    }
+}// namespace
+
+int main(int argc, const char **argv) {
+    Runner runner(argc, argv);
+
+    Section("task objects");
+    runner.Run("Task, two-pointer capture (inline)", [](std::uint64_t i) {
+        std::uint64_t sink = 0;
+        auto *p = &sink;
+        resultpp::internal::executor::Task task([p, i] { *p += i; });
+        task();
+        DoNotOptimize(sink);
+    });
+    runner.Run("Task, 64-byte capture (heap)", [](std::uint64_t i) {
+        std::uint64_t sink = 0;
+        std::uint64_t pad[8] = {i};
+        auto *p = &sink;
+        resultpp::internal::executor::Task task([p, pad] { *p += pad[0]; });
+        task();
+        DoNotOptimize(sink);
+    });
+    runner.Run("std::function, two-pointer capture", [](std::uint64_t i) {
+        std::uint64_t sink = 0;
+        auto *p = &sink;
+        std::function<void()> task([p, i] { *p += i; });
+        task();
+        DoNotOptimize(sink);
+    });
+
+    Unpin();
+    auto cores = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<unsigned> counts;
+    for (unsigned workers = 1; workers < cores; workers *= 2) counts.push_back(workers);
+    counts.push_back(cores);
+
+    Section("tiny tasks posted from outside the pool, ns per task");
+    for (auto workers : counts) {
+        std::printf("%2u worker(s): Executor %8.2f   mutex + condition variable %8.2f\n", workers,
+                    PostedNs<resultpp::Executor>(workers), PostedNs<LockedPool>(workers));
+    }
+
+    Section("fork-join: each task spawns two until 2^17 leaves, ns per task");
+    for (auto workers : counts) {
+        std::printf("%2u worker(s): Executor %8.2f   mutex + condition variable %8.2f\n", workers,
+                    ForkJoinNs<resultpp::Executor>(workers), ForkJoinNs<LockedPool>(workers));
+    }
+
+    Section("Submit + Get round trip from outside the pool");
+    for (auto workers : counts) {
+        auto [median, p99] = RoundTripNs(workers);
+        std::printf("%2u worker(s): median %8.0f ns   p99 %8.0f ns\n", workers, median, p99);
+    }
+    return runner.Finish();
+}
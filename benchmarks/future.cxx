@@ -0,0 +1,102 @@
+// ResultPromise/ResultFuture against std::promise/std::future holding a Result: the cost of one promise/future pair
+// set and read on one thread, a chain of continuations, and the latency of handing a value to another thread and
+// back (ping-pong over pre-created pairs, reported per one-way handoff).
+#include <Future.hxx>
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "runner.hxx"
+
+using resultpp::bench::DoNotOptimize;
+using resultpp::bench::Runner;
+using resultpp::bench::Section;
+using resultpp::bench::Unpin;
+
+namespace {
+    using Result = resultpp::Result<int>;
+
+    constexpr int kRoundTrips = 20000;
+
+    struct ResultppPair {
+        using promise_t = resultpp::ResultPromise<int>;
+        using future_t = resultpp::ResultFuture<int>;
+        static constexpr const char *name = "ResultPromise/ResultFuture";
+
+        static future_t FutureOf(promise_t &promise) { return promise.GetFuture(); }
+        static void Set(promise_t &promise, int value) { promise.Set(value); }
+        static Result Get(future_t &future) { return std::move(future).Get(); }
+    };
+
+    struct StdPair {
+        using promise_t = std::promise<Result>;
+        using future_t = std::future<Result>;
+        static constexpr const char *name = "std::promise/std::future<Result>";
+
+        static future_t FutureOf(promise_t &promise) { return promise.get_future(); }
+        static void Set(promise_t &promise, int value) { promise.set_value(Result(value)); }
+        static Result Get(future_t &future) { return future.get(); }
+    };
+
+    /**
+     * @brief Nanoseconds per one-way handoff: the main thread sets `there[i]` and waits on `back[i]`, which a
+     * second thread sets as soon as `there[i]` is ready.
+     */
+    template<typename P>
+    double HandoffNs() {
+        std::vector<typename P::promise_t> there(kRoundTrips), back(kRoundTrips);
+        std::vector<typename P::future_t> thereFutures, backFutures;
+        for (int i = 0; i < kRoundTrips; ++i) {
+            thereFutures.push_back(P::FutureOf(there[i]));
+            backFutures.push_back(P::FutureOf(back[i]));
+        }
+
+        std::thread echo([&] {
+            Unpin();
+            for (int i = 0; i < kRoundTrips; ++i) P::Set(back[i], P::Get(thereFutures[i]).Data() + 1);
+        });
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kRoundTrips; ++i) {
+            P::Set(there[i], i);
+            DoNotOptimize(P::Get(backFutures[i]));
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        echo.join();
+        return std::chrono::duration<double, std::nano>(elapsed).count() / (2.0 * kRoundTrips);
+    }
+
+    template<typename P>
+    void RunPair(Runner &runner) {
+        runner.Run(std::string(P::name) + ": create, set, get", [](std::uint64_t i) {
+            typename P::promise_t promise;
+            auto future = P::FutureOf(promise);
+            P::Set(promise, static_cast<int>(i));
+            DoNotOptimize(P::Get(future));
+        });
+    }
+}// namespace
+
+int main(int argc, const char **argv) {
+    Runner runner(argc, argv);
+
+    Section("one thread");
+    RunPair<ResultppPair>(runner);
+    RunPair<StdPair>(runner);
+    runner.Run("ResultPromise, 3 Then continuations, set, get", [](std::uint64_t i) {
+        resultpp::ResultPromise<int> promise;
+        auto future = promise.GetFuture()
+                              .Then([](int v) { return v + 1; })
+                              .Then([](int v) { return Result(v * 2); })
+                              .Then([](int v) { return static_cast<long>(v); });
+        promise.Set(static_cast<int>(i));
+        DoNotOptimize(std::move(future).Get());
+    });
+
+    Section("handoff to another thread and back");
+    std::printf("%-60s %10.2f ns per handoff\n", ResultppPair::name, HandoffNs<ResultppPair>());
+    std::printf("%-60s %10.2f ns per handoff\n", StdPair::name, HandoffNs<StdPair>());
+    return runner.Finish();
+}
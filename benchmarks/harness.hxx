@@ -0,0 +1,105 @@
+#ifndef RESULTPP_BENCHMARKS_HARNESS_HXX
+#define RESULTPP_BENCHMARKS_HARNESS_HXX
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstdint> // std::uint64_t
+#include <cstdio>  // std::printf
+#include <string>  // std::string
+#include <utility> // std::forward
+
+namespace resultpp::bench {
+    /**
+     * @brief Prevent the compiler from discarding the computation of `value`.
+     */
+    template<typename T>
+    inline void DoNotOptimize(const T &value) { asm volatile("" : : "r,m"(value) : "memory"); }
+
+    /**
+     * @brief Force the compiler to assume all memory may have been read or written.
+     */
+    inline void ClobberMemory() { asm volatile("" : : : "memory"); }
+
+    /**
+     * @brief Hide the provenance of `pointer` so the pointee cannot be constant-folded.
+     */
+    template<typename T>
+    inline T *Opaque(T *pointer) {
+        asm volatile("" : "+r"(pointer));
+        return pointer;
+    }
+
+    /**
+     * @struct Measurement
+     * @brief Outcome of timing a single benchmark body.
+     */
+    struct Measurement {
+        std::string name;
+        std::uint64_t iterations = 0;
+        double nsPerOp = 0.0;
+    };
+
+    /**
+     * @brief Time `iterations` calls of `body(i)` after a short warm-up.
+     *
+     * @param name The label reported for this measurement.
+     * @param iterations The number of timed calls.
+     * @param body Callable taking the iteration index as `std::uint64_t`.
+     * @return The measured cost per call.
+     */
+    template<typename F>
+    Measurement Measure(std::string name, std::uint64_t iterations, F &&body) {
+        for (std::uint64_t i = 0; i < iterations / 10; ++i) body(i);
+
+        auto start = std::chrono::steady_clock::now();
+        for (std::uint64_t i = 0; i < iterations; ++i) body(i);
+        auto stop = std::chrono::steady_clock::now();
+
+        auto ns = std::chrono::duration<double, std::nano>(stop - start).count();
+        return {std::move(name), iterations, ns / static_cast<double>(iterations)};
+    }
+
+    /**
+     * @brief Pick an iteration count for which `body(i)` runs for roughly `budget`.
+     *
+     * The count is calibrated by doubling until one batch takes a tenth of the budget, so cheap bodies get
+     * millions of iterations and expensive ones (thrown exceptions) still finish quickly.
+     */
+    template<typename F>
+    std::uint64_t Calibrate(F &&body, std::chrono::nanoseconds budget) {
+        std::uint64_t iterations = 64;
+        for (;;) {
+            auto start = std::chrono::steady_clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) body(i);
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed * 10 >= budget || iterations >= (1ULL << 32U)) {
+                auto scale = static_cast<double>(budget.count()) / static_cast<double>(elapsed.count() + 1);
+                return static_cast<std::uint64_t>(static_cast<double>(iterations) * scale) + 1;
+            }
+            iterations *= 2;
+        }
+    }
+
+    /**
+     * @brief Time `body(i)` for roughly `budget`, picking the iteration count automatically.
+     */
+    template<typename F>
+    Measurement Measure(std::string name, F &&body, std::chrono::nanoseconds budget = std::chrono::milliseconds(50)) {
+        auto iterations = Calibrate(body, budget);
+        return Measure(std::move(name), iterations, std::forward<F>(body));
+    }
+
+    /**
+     * @brief Print a section header for a group of related measurements.
+     */
+    inline void Section(const char *title) { std::printf("\n== %s ==\n", title); }
+
+    /**
+     * @brief Print a measurement as a single aligned line.
+     */
+    inline void Report(const Measurement &m) {
+        std::printf("%-56s %12.2f ns/op  (%llu iterations)\n", m.name.c_str(), m.nsPerOp,
+                    static_cast<unsigned long long>(m.iterations));
+    }
+}// namespace resultpp::bench
+
+#endif//RESULTPP_BENCHMARKS_HARNESS_HXX
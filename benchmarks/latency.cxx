@@ -0,0 +1,57 @@
+#include <Latency.hxx>
+#include <resultpp.hxx>
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "runner.hxx"
+
+using resultpp::bench::DoNotOptimize;
+using resultpp::bench::Runner;
+using resultpp::bench::Section;
+using resultpp::bench::Unpin;
+
+namespace {
+    /**
+     * @brief A lookup whose error path is slower than its success path, as with a cache miss falling through to disk.
+     */
+    [[gnu::noinline]] resultpp::Result<int> Lookup(std::uint64_t i) {
+        if (i % 10 != 0) return resultpp::Result<int>(static_cast<int>(i));
+
+        int spin = 0;
+        for (int k = 0; k < 200; ++k) DoNotOptimize(spin += k);
+        return {0, std::string(i % 20 == 0 ? "timeout" : "not found")};
+    }
+
+    std::int64_t CodeOf(const resultpp::Result<int> &r) { return r.Message() == "timeout" ? 110 : 2; }
+}// namespace
+
+int main(int argc, const char **argv) {
+    Runner runner(argc, argv);
+    static resultpp::LatencyRecorder lookups("Lookup");
+
+    Section("overhead");
+    runner.Run("Lookup, untimed", [](std::uint64_t i) { DoNotOptimize(Lookup(i)); });
+    runner.Run("Lookup, Timed()", [](std::uint64_t i) {
+        DoNotOptimize(resultpp::Timed(lookups, [i] { return Lookup(i); }, &CodeOf));
+    });
+    runner.Run("Lookup, RESULTPP_TIMED", [](std::uint64_t i) { DoNotOptimize(RESULTPP_TIMED("Lookup (macro)", Lookup(i))); });
+    runner.Run("ReadTicks()", [](std::uint64_t) { DoNotOptimize(resultpp::ReadTicks()); });
+
+    Unpin();
+    Section("from four threads, merged on read");
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([] {
+            for (std::uint64_t i = 0; i < 200'000; ++i) DoNotOptimize(resultpp::Timed(lookups, [i] { return Lookup(i); }, &CodeOf));
+        });
+    }
+    for (auto &worker : workers) worker.join();
+    resultpp::DumpLatency(stdout);
+
+    Section("csv export");
+    resultpp::ExportLatencyCsv(stdout);
+    return runner.Finish();
+}
@@ -0,0 +1,121 @@
+// A four-stage chain `Map(f).FlatMap(g).Map(h).MapErr(e)` evaluated eagerly (a Result per stage), lazily through
+// `Lazy()...Eval()` (one pass), and written by hand with explicit branches, over int and std::string payloads and
+// inputs failing at the source or in the FlatMap stage.
+#include <resultpp.hxx>
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include "runner.hxx"
+
+using resultpp::bench::DoNotOptimize;
+using resultpp::bench::Runner;
+using resultpp::bench::Section;
+
+namespace {
+    constexpr std::size_t kInputs = 1024;
+
+    template<typename T>
+    using Result = resultpp::Result<T>;
+
+    /**
+     * @brief Inputs where one in `errEvery` fails at the source and one in `rejectEvery` in the FlatMap stage.
+     */
+    template<typename T, typename Make>
+    std::array<Result<T>, kInputs> MakeInputs(std::size_t errEvery, Make make) {
+        std::array<Result<T>, kInputs> inputs;
+        for (std::size_t i = 0; i < kInputs; ++i) {
+            if (errEvery != 0 && i % errEvery == 0) inputs[i] = Result<T>(T{}, std::string("source unavailable"));
+            else inputs[i] = Result<T>(make(i));
+        }
+        return inputs;
+    }
+
+    // Stages are closures rather than functions, so that a chain stores them without turning them into pointers.
+    struct IntStages {
+        using T = int;
+        static constexpr auto F = [](int v) { return v * 3 + 1; };
+        static constexpr auto G = [](int v) {
+            if (v % 97 == 0) return Result<int>(0, std::string("rejected"));
+            return Result<int>(v >> 1);
+        };
+        static constexpr auto H = [](int v) { return v ^ 0x5a5a; };
+        static int Read(const Result<int> &r) { return r.IsOk() ? r.Data() : -1; }
+    };
+
+    struct StringStages {
+        using T = std::string;
+        static constexpr auto F = [](std::string v) {
+            v += "/normalised";
+            return v;
+        };
+        static constexpr auto G = [](std::string v) {
+            if (v.size() % 7 == 0) return Result<std::string>(std::string{}, std::string("rejected"));
+            return Result<std::string>(std::move(v));
+        };
+        static constexpr auto H = [](std::string v) {
+            v[0] = '#';
+            return v;
+        };
+        static long Read(const Result<std::string> &r) { return r.IsOk() ? static_cast<long>(r.Data().size()) : -1; }
+    };
+
+    constexpr auto Annotate = [](std::string message) {
+        message.insert(0, "lookup: ");
+        return message;
+    };
+
+    template<typename S>
+    Result<typename S::T> Eager(const Result<typename S::T> &r) {
+        return r.Map(S::F).FlatMap(S::G).Map(S::H).MapErr(Annotate);
+    }
+
+    template<typename S>
+    Result<typename S::T> Lazy(const Result<typename S::T> &r) {
+        return r.Lazy().Map(S::F).FlatMap(S::G).Map(S::H).MapErr(Annotate).Eval();
+    }
+
+    template<typename S>
+    Result<typename S::T> HandWritten(const Result<typename S::T> &r) {
+        using result_t = Result<typename S::T>;
+        if (!r.IsOk()) return result_t(typename S::T{}, Annotate(r.Message()));
+        auto g = S::G(S::F(r.Data()));
+        if (!g.IsOk()) return result_t(typename S::T{}, Annotate(std::move(g).Message()));
+        return result_t(S::H(std::move(g).Data()));
+    }
+
+    template<typename S, typename Make>
+    bool Run(Runner &runner, const std::string &name, std::size_t errEvery, Make make) {
+        auto inputs = MakeInputs<typename S::T>(errEvery, make);
+        for (const auto &input : inputs) {
+            if (S::Read(Eager<S>(input)) != S::Read(HandWritten<S>(input)) ||
+                S::Read(Lazy<S>(input)) != S::Read(HandWritten<S>(input))) {
+                std::fprintf(stderr, "%s: chains disagree\n", name.c_str());
+                return false;
+            }
+        }
+
+        runner.Run(name + ", hand-written", [&](std::uint64_t i) { DoNotOptimize(HandWritten<S>(inputs[i % kInputs])); });
+        runner.Run(name + ", eager chain", [&](std::uint64_t i) { DoNotOptimize(Eager<S>(inputs[i % kInputs])); });
+        runner.Run(name + ", lazy chain", [&](std::uint64_t i) { DoNotOptimize(Lazy<S>(inputs[i % kInputs])); });
+        return true;
+    }
+}// namespace
+
+int main(int argc, const char **argv) {
+    Runner runner(argc, argv);
+    auto ints = [](std::size_t i) { return static_cast<int>(i); };
+    auto strings = [](std::size_t i) { return "request payload number " + std::to_string(i); };
+
+    bool agree = true;
+    Section("Result<int>");
+    agree &= Run<IntStages>(runner, "Result<int>, 0% source Err", 0, ints);
+    agree &= Run<IntStages>(runner, "Result<int>, 10% source Err", 10, ints);
+
+    Section("Result<std::string>");
+    agree &= Run<StringStages>(runner, "Result<std::string>, 0% source Err", 0, strings);
+    agree &= Run<StringStages>(runner, "Result<std::string>, 10% source Err", 10, strings);
+    if (!agree) return 1;
+    return runner.Finish();
+}
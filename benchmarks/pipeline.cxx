@@ -0,0 +1,131 @@
+// A 10-stage string-processing pipeline over Result<std::string>: chained on named lvalues (the `const &` combinators,
+// one payload copy per stage), chained on the temporary (the consuming combinators, transforming the payload in
+// place), and written by hand on a plain std::string. Err inputs show what passing an error through ten stages costs.
+#include <resultpp.hxx>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "runner.hxx"
+
+using resultpp::bench::DoNotOptimize;
+using resultpp::bench::Runner;
+using resultpp::bench::Section;
+
+namespace {
+    using Result = resultpp::Result<std::string>;
+
+    void Trim(std::string &s) {
+        auto first = s.find_first_not_of(' ');
+        auto last = s.find_last_not_of(' ');
+        if (first == std::string::npos) s.clear();
+        else s.assign(s, first, last - first + 1);
+    }
+
+    void Lower(std::string &s) {
+        for (auto &c : s) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+
+    void DashesToUnderscores(std::string &s) { std::replace(s.begin(), s.end(), '-', '_'); }
+
+    void SpacesToDots(std::string &s) { std::replace(s.begin(), s.end(), ' ', '.'); }
+
+    void Prefix(std::string &s) { s.insert(0, "ns/"); }
+
+    void Suffix(std::string &s) { s.append(".v1"); }
+
+    void Capitalise(std::string &s) {
+        if (s.size() > 3) s[3] = static_cast<char>(std::toupper(static_cast<unsigned char>(s[3])));
+    }
+
+    void Truncate(std::string &s) {
+        if (s.size() > 72) s.resize(72);
+    }
+
+    void Checksum(std::string &s) {
+        unsigned sum = 0;
+        for (auto c : s) sum += static_cast<unsigned char>(c);
+        s.push_back(static_cast<char>('0' + sum % 10));
+    }
+
+    void DropVersion(std::string &s) {
+        auto dot = s.rfind(".v1");
+        if (dot != std::string::npos) s.erase(dot, 3);
+    }
+
+    /**
+     * @brief A stage as a combinator callable: the payload is taken by value, so the `const &` combinators copy it
+     * and the consuming ones move it.
+     */
+    template<void (*Stage)(std::string &)>
+    std::string ByValue(std::string s) {
+        Stage(s);
+        return s;
+    }
+
+    std::string HandWritten(std::string s) {
+        Trim(s);
+        Lower(s);
+        DashesToUnderscores(s);
+        SpacesToDots(s);
+        Prefix(s);
+        Suffix(s);
+        Capitalise(s);
+        Truncate(s);
+        Checksum(s);
+        DropVersion(s);
+        return s;
+    }
+
+    Result Lvalues(const Result &input) {
+        auto r1 = input.Map(ByValue<Trim>);
+        auto r2 = r1.Map(ByValue<Lower>);
+        auto r3 = r2.Map(ByValue<DashesToUnderscores>);
+        auto r4 = r3.Map(ByValue<SpacesToDots>);
+        auto r5 = r4.Map(ByValue<Prefix>);
+        auto r6 = r5.Map(ByValue<Suffix>);
+        auto r7 = r6.Map(ByValue<Capitalise>);
+        auto r8 = r7.Map(ByValue<Truncate>);
+        auto r9 = r8.Map(ByValue<Checksum>);
+        return r9.Map(ByValue<DropVersion>);
+    }
+
+    Result Rvalues(Result input) {
+        return std::move(input)
+                .Map(ByValue<Trim>)
+                .Map(ByValue<Lower>)
+                .Map(ByValue<DashesToUnderscores>)
+                .Map(ByValue<SpacesToDots>)
+                .Map(ByValue<Prefix>)
+                .Map(ByValue<Suffix>)
+                .Map(ByValue<Capitalise>)
+                .Map(ByValue<Truncate>)
+                .Map(ByValue<Checksum>)
+                .Map(ByValue<DropVersion>);
+    }
+}// namespace
+
+int main(int argc, const char **argv) {
+    Runner runner(argc, argv);
+
+    const std::string payload = "   Request-Handler Stage Of The Ingest-Pipeline For Tenant 42 (Region EU-West)   ";
+    const Result ok(payload);
+    const Result err(std::string{}, std::string("upstream rejected the request: quota exceeded for tenant 42"));
+    if (Lvalues(ok).Data() != HandWritten(payload) || Rvalues(ok).Data() != HandWritten(payload)) {
+        std::fprintf(stderr, "pipelines disagree\n");
+        return 1;
+    }
+
+    Section("10 stages, Ok input");
+    runner.Run("hand-written std::string", [&](std::uint64_t) { DoNotOptimize(HandWritten(payload)); });
+    runner.Run("Result, lvalue chain (copy per stage)", [&](std::uint64_t) { DoNotOptimize(Lvalues(ok)); });
+    runner.Run("Result, rvalue chain (in place)", [&](std::uint64_t) { DoNotOptimize(Rvalues(ok)); });
+
+    Section("10 stages, Err input");
+    runner.Run("Result, lvalue chain", [&](std::uint64_t) { DoNotOptimize(Lvalues(err)); });
+    runner.Run("Result, rvalue chain", [&](std::uint64_t) { DoNotOptimize(Rvalues(err)); });
+    return runner.Finish();
+}
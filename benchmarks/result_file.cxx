@@ -0,0 +1,92 @@
+// Write throughput of ResultFileWriter and scan throughput of a mapped ResultFile. The row count defaults to 2^24 and
+// can be raised with RESULTPP_BENCH_ROWS (e.g. 1000000000 for the full nightly size, which needs 5 GB of disk);
+// timings are also projected to one billion rows.
+#include <ResultFile.hxx>
+#include <resultpp.hxx>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+#include "harness.hxx"
+
+using resultpp::bench::DoNotOptimize;
+using resultpp::bench::Section;
+
+namespace {
+    constexpr double kBillion = 1e9;
+
+    template<typename F>
+    double BestSeconds(int repetitions, F &&body) {
+        double best = 0.0;
+        for (int r = 0; r < repetitions; ++r) {
+            auto start = std::chrono::steady_clock::now();
+            body();
+            auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (r == 0 || seconds < best) best = seconds;
+        }
+        return best;
+    }
+
+    void Report(const char *name, double seconds, std::uint64_t rows, std::uint64_t bytes) {
+        std::printf("%-40s %8.2f ns/row  %8.2f GB/s  %8.1f s per 1B rows\n", name, seconds * 1e9 / static_cast<double>(rows),
+                    static_cast<double>(bytes) / seconds / 1e9, seconds / static_cast<double>(rows) * kBillion);
+    }
+}// namespace
+
+int main() {
+    std::uint64_t rows = 1ULL << 24U;
+    if (const char *env = std::getenv("RESULTPP_BENCH_ROWS")) rows = std::strtoull(env, nullptr, 10);
+    auto path = (std::filesystem::temp_directory_path() / "resultpp_bench.results").string();
+    std::printf("%llu rows of Result<int>, 0.1%% Err over 8 distinct messages, in %s\n", static_cast<unsigned long long>(rows),
+                path.c_str());
+
+    const std::string messages[8] = {"timeout", "not found", "permission denied", "checksum mismatch",
+                                     "schema violation", "duplicate key", "quota exceeded", "connection reset"};
+
+    Section("write");
+    auto writeSeconds = BestSeconds(1, [&] {
+        resultpp::ResultFileWriter<int> writer;
+        writer.Open(path).Unwrap();
+        for (std::uint64_t i = 0; i < rows; ++i) {
+            if (i % 1000 == 999) writer.AppendErr(messages[(i / 1000) % 8]);
+            else writer.Append(static_cast<int>(i));
+        }
+        writer.Finish().Unwrap();
+    });
+    auto fileBytes = std::filesystem::file_size(path);
+    Report("ResultFileWriter::Append + Finish", writeSeconds, rows, fileBytes);
+
+    Section("scan (mapped, warm page cache)");
+    resultpp::ResultFile<int> file;
+    file.Open(path).Unwrap();
+
+    auto errorBytes = file.ErrorCount() * 12;
+    Report("ForEachError", BestSeconds(3, [&] {
+               std::uint64_t length = 0;
+               file.ForEachError([&](std::uint64_t, std::string_view message) { length += message.size(); });
+               DoNotOptimize(length);
+           }),
+           rows, errorBytes);
+
+    Report("rows, IsOk() on each", BestSeconds(3, [&] {
+               std::uint64_t errors = 0;
+               for (auto row : file) errors += row.IsErr();
+               DoNotOptimize(errors);
+           }),
+           rows, rows / 8);
+
+    Report("rows, sum of Ok payloads", BestSeconds(3, [&] {
+               std::int64_t sum = 0;
+               for (std::uint64_t i = 0; i < file.Size(); ++i) {
+                   if (file.IsOk(i)) sum += file.Data(i);
+               }
+               DoNotOptimize(sum);
+           }),
+           rows, rows * sizeof(int) + rows / 8);
+
+    std::filesystem::remove(path);
+    return 0;
+}
@@ -0,0 +1,269 @@
+#ifndef RESULTPP_BENCHMARKS_RUNNER_HXX
+#define RESULTPP_BENCHMARKS_RUNNER_HXX
+
+#include <algorithm> // std::nth_element
+#include <cmath>     // std::erfc, std::sqrt
+#include <cstdio>    // std::printf, std::fprintf
+#include <cstdlib>   // std::atoi, std::atof
+#include <fstream>   // std::ifstream, std::ofstream
+#include <map>       // std::map
+#include <sstream>   // std::istringstream
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+#if defined(__linux__)
+#include <sched.h> // sched_setaffinity
+#endif
+
+#include "harness.hxx"
+
+namespace resultpp::bench {
+    /**
+     * @struct Options
+     * @brief Command line options shared by every benchmark binary using `Runner`.
+     */
+    struct Options {
+        int repetitions = 7;                       ///< Timed batches per benchmark.
+        std::chrono::milliseconds budget{70};      ///< Total time spent per benchmark, across repetitions.
+        int cpu = -1;                              ///< CPU to pin to; `-1` pins to the current CPU, `-2` disables.
+        double threshold = 0.05;                   ///< Relative slowdown of the median reported as a regression.
+        double confidence = 0.99;                  ///< Required confidence that the slowdown is not noise.
+        std::string record;                        ///< Baseline file to write.
+        std::string compare;                       ///< Baseline file to compare against.
+        std::string filter;                        ///< Only run benchmarks whose name contains this string.
+    };
+
+    /**
+     * @struct Statistics
+     * @brief Robust summary of the repetitions of one benchmark.
+     */
+    struct Statistics {
+        std::string name;
+        std::uint64_t iterations = 0;
+        std::vector<double> samples;///< ns/op of each repetition.
+        double median = 0.0;
+        double mad = 0.0;///< Median absolute deviation from `median`.
+    };
+
+    inline double Median(std::vector<double> values) {
+        if (values.empty()) return 0.0;
+        auto middle = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+        std::nth_element(values.begin(), middle, values.end());
+        if (values.size() % 2 == 1) return *middle;
+        return (*middle + *std::max_element(values.begin(), middle)) / 2.0;
+    }
+
+    inline double MedianAbsoluteDeviation(const std::vector<double> &values, double median) {
+        std::vector<double> deviations;
+        deviations.reserve(values.size());
+        for (auto value : values) deviations.push_back(std::abs(value - median));
+        return Median(std::move(deviations));
+    }
+
+    /**
+     * @brief One-sided Mann-Whitney U test.
+     * @return The p-value of the hypothesis that `candidate` is not slower than `baseline`.
+     */
+    inline double SlowerPValue(const std::vector<double> &baseline, const std::vector<double> &candidate) {
+        if (baseline.empty() || candidate.empty()) return 1.0;
+
+        double u = 0.0;
+        for (auto c : candidate) {
+            for (auto b : baseline) u += c > b ? 1.0 : (c == b ? 0.5 : 0.0);
+        }
+
+        auto n1 = static_cast<double>(candidate.size());
+        auto n2 = static_cast<double>(baseline.size());
+        auto mean = n1 * n2 / 2.0;
+        auto sd = std::sqrt(n1 * n2 * (n1 + n2 + 1.0) / 12.0);
+        auto z = (u - mean) / sd;
+        return 0.5 * std::erfc(z / std::sqrt(2.0));
+    }
+
+    /**
+     * @brief Write `results` as a CSV baseline: name, median, MAD, iterations and every sample.
+     */
+    inline bool WriteBaseline(const std::string &path, const std::vector<Statistics> &results) {
+        std::ofstream out(path);
+        if (!out) return false;
+
+        out << "name,median_ns,mad_ns,iterations,samples_ns\n";
+        for (const auto &r : results) {
+            out << '"' << r.name << "\"," << r.median << ',' << r.mad << ',' << r.iterations << ',';
+            for (std::size_t i = 0; i < r.samples.size(); ++i) out << (i == 0 ? "" : " ") << r.samples[i];
+            out << '\n';
+        }
+        return static_cast<bool>(out);
+    }
+
+    /**
+     * @brief Read a baseline written by `WriteBaseline`, keyed by benchmark name.
+     */
+    inline std::map<std::string, Statistics> ReadBaseline(const std::string &path) {
+        std::map<std::string, Statistics> baseline;
+        std::ifstream in(path);
+        std::string line;
+        std::getline(in, line);
+
+        while (std::getline(in, line)) {
+            if (line.size() < 2 || line[0] != '"') continue;
+            auto close = line.find('"', 1);
+            if (close == std::string::npos) continue;
+
+            Statistics s;
+            s.name = line.substr(1, close - 1);
+            std::istringstream fields(line.substr(close + 2));
+            std::string field;
+            if (std::getline(fields, field, ',')) s.median = std::atof(field.c_str());
+            if (std::getline(fields, field, ',')) s.mad = std::atof(field.c_str());
+            if (std::getline(fields, field, ',')) s.iterations = std::strtoull(field.c_str(), nullptr, 10);
+            if (std::getline(fields, field)) {
+                std::istringstream samples(field);
+                for (double sample; samples >> sample;) s.samples.push_back(sample);
+            }
+            baseline.emplace(s.name, std::move(s));
+        }
+        return baseline;
+    }
+
+    /**
+     * @brief Let the calling thread, and the threads it starts afterwards, run on any CPU again. `Runner` pins the
+     * process to one CPU and new threads inherit that mask, so call this before timing anything multi-threaded.
+     */
+    inline void Unpin() {
+#if defined(__linux__)
+        cpu_set_t all;
+        CPU_ZERO(&all);
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) CPU_SET(cpu, &all);
+        sched_setaffinity(0, sizeof(all), &all);
+#endif
+    }
+
+    /**
+     * @class Runner
+     * @brief Runs benchmarks with warm-up and repetitions, and records or compares against a baseline.
+     *
+     * Recognised arguments:
+     *
+     * \- `--record FILE`: write the results to a CSV baseline.
+     * \- `--compare FILE`: compare against a baseline; the process exits with `1` on regressions.
+     * \- `--threshold PCT`: relative median slowdown treated as a regression (default 5).
+     * \- `--confidence P`: confidence required before flagging (default 0.99).
+     * \- `--repetitions N`, `--budget-ms MS`: timed batches per benchmark and total time per benchmark.
+     * \- `--cpu N`: pin to CPU `N` (`-2` disables pinning; the default pins to the starting CPU).
+     * \- `--filter TEXT`: only run benchmarks whose name contains `TEXT`.
+     */
+    class Runner {
+        Options _options;
+        std::vector<Statistics> _results;
+        std::map<std::string, Statistics> _baseline;
+        std::size_t _regressions = 0;
+
+        void Pin() {
+#if defined(__linux__)
+            auto cpu = _options.cpu == -1 ? sched_getcpu() : _options.cpu;
+            if (cpu < 0) return;
+
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            if (sched_setaffinity(0, sizeof(set), &set) != 0) std::fprintf(stderr, "warning: unable to pin to CPU %d\n", cpu);
+            else std::printf("pinned to CPU %d\n", cpu);
+#endif
+        }
+
+        void Print(const Statistics &s) {
+            std::printf("%-56s %10.2f ns/op  +/- %6.2f", s.name.c_str(), s.median, s.mad);
+
+            auto found = _baseline.find(s.name);
+            if (found == _baseline.end()) {
+                std::printf("\n");
+                return;
+            }
+
+            const auto &base = found->second;
+            auto delta = base.median > 0.0 ? (s.median - base.median) / base.median : 0.0;
+            auto alpha = 1.0 - _options.confidence;
+            const char *verdict = "";
+            if (delta > _options.threshold && SlowerPValue(base.samples, s.samples) < alpha) {
+                verdict = "  REGRESSION";
+                ++_regressions;
+            } else if (-delta > _options.threshold && SlowerPValue(s.samples, base.samples) < alpha) {
+                verdict = "  improved";
+            }
+            std::printf("  | base %10.2f  %+7.1f%%%s\n", base.median, delta * 100.0, verdict);
+        }
+
+    public:
+        Runner(int argc, const char **argv) {
+            for (int i = 1; i < argc; ++i) {
+                std::string arg = argv[i];
+                const char *value = i + 1 < argc ? argv[i + 1] : "";
+                if (arg == "--record") _options.record = value, ++i;
+                else if (arg == "--compare") _options.compare = value, ++i;
+                else if (arg == "--threshold") _options.threshold = std::atof(value) / 100.0, ++i;
+                else if (arg == "--confidence") _options.confidence = std::atof(value), ++i;
+                else if (arg == "--repetitions") _options.repetitions = std::max(1, std::atoi(value)), ++i;
+                else if (arg == "--budget-ms") _options.budget = std::chrono::milliseconds(std::atoi(value)), ++i;
+                else if (arg == "--cpu") _options.cpu = std::atoi(value), ++i;
+                else if (arg == "--filter") _options.filter = value, ++i;
+                else std::fprintf(stderr, "warning: ignoring unknown argument '%s'\n", arg.c_str());
+            }
+
+            Pin();
+            if (!_options.compare.empty()) {
+                _baseline = ReadBaseline(_options.compare);
+                if (_baseline.empty()) std::fprintf(stderr, "warning: no entries read from '%s'\n", _options.compare.c_str());
+            }
+        }
+
+        [[nodiscard]] const Options &GetOptions() const noexcept { return _options; }
+
+        /**
+         * @brief Warm up, calibrate, then time `body(i)` over the configured repetitions.
+         */
+        template<typename F>
+        void Run(const std::string &name, F &&body) {
+            if (!_options.filter.empty() && name.find(_options.filter) == std::string::npos) return;
+
+            auto perRepetition = _options.budget / _options.repetitions;
+            Statistics s;
+            s.name = name;
+            s.iterations = Calibrate(body, perRepetition);
+            for (std::uint64_t i = 0; i < s.iterations; ++i) body(i);
+
+            for (int r = 0; r < _options.repetitions; ++r) {
+                auto start = std::chrono::steady_clock::now();
+                for (std::uint64_t i = 0; i < s.iterations; ++i) body(i);
+                auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+                s.samples.push_back(ns / static_cast<double>(s.iterations));
+            }
+
+            s.median = Median(s.samples);
+            s.mad = MedianAbsoluteDeviation(s.samples, s.median);
+            Print(s);
+            _results.push_back(std::move(s));
+        }
+
+        /**
+         * @brief Write the baseline if requested and summarise the comparison.
+         * @return The process exit code: `1` if a regression was detected, `0` otherwise.
+         */
+        int Finish() {
+            if (!_options.record.empty()) {
+                if (!WriteBaseline(_options.record, _results)) {
+                    std::fprintf(stderr, "error: unable to write baseline '%s'\n", _options.record.c_str());
+                    return 2;
+                }
+                std::printf("\nrecorded %zu results to %s\n", _results.size(), _options.record.c_str());
+            }
+
+            if (_options.compare.empty()) return 0;
+            std::printf("\n%zu regression(s) against %s (threshold %.1f%%, confidence %.3f)\n", _regressions,
+                        _options.compare.c_str(), _options.threshold * 100.0, _options.confidence);
+            return _regressions == 0 ? 0 : 1;
+        }
+    };
+}// namespace resultpp::bench
+
+#endif//RESULTPP_BENCHMARKS_RUNNER_HXX
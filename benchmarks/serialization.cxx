@@ -0,0 +1,110 @@
+// Throughput of the binary Result encoding: encoding into a buffer, and scanning a buffer of encoded results with
+// ResultView (zero copy) against decoding every record back into a Result.
+#include <Serialization.hxx>
+#include <resultpp.hxx>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "runner.hxx"
+
+using resultpp::ResultView;
+using resultpp::bench::DoNotOptimize;
+using resultpp::bench::Runner;
+using resultpp::bench::Section;
+
+namespace {
+    constexpr std::size_t kRecords = 1 << 16;
+
+    /**
+     * @brief One in `errEvery` results is an Err, the others carry `make(i)`.
+     */
+    template<typename T, typename F>
+    std::vector<resultpp::Result<T>> MakeResults(std::size_t errEvery, F make) {
+        std::vector<resultpp::Result<T>> results;
+        results.reserve(kRecords);
+        for (std::size_t i = 0; i < kRecords; ++i) {
+            if (i % errEvery == 0) results.emplace_back(T{}, std::string("record rejected by validation"));
+            else results.emplace_back(make(i));
+        }
+        return results;
+    }
+
+    template<typename T>
+    std::vector<std::byte> EncodeAll(const std::vector<resultpp::Result<T>> &results) {
+        std::vector<std::byte> buffer;
+        for (const auto &result : results) resultpp::Encode(result, buffer);
+        return buffer;
+    }
+
+    template<typename T>
+    void RunEncode(Runner &runner, const std::string &name, const std::vector<resultpp::Result<T>> &results) {
+        std::vector<std::byte> buffer(EncodeAll(results).size());
+        runner.Run(name + " (" + std::to_string(buffer.size() / kRecords) + " B/record)", [&](std::uint64_t) {
+            auto *out = buffer.data();
+            for (const auto &result : results) out = resultpp::Encode(result, out);
+            DoNotOptimize(out);
+        });
+    }
+
+    template<typename T>
+    void RunScan(Runner &runner, const std::string &name, const std::vector<resultpp::Result<T>> &results) {
+        auto buffer = EncodeAll(results);
+        const auto *end = buffer.data() + buffer.size();
+
+        runner.Run(name + ", ResultView", [&](std::uint64_t) {
+            std::size_t errors = 0;
+            for (const auto *p = buffer.data(); p != end;) {
+                ResultView<T> view(p);
+                errors += view.IsErr();
+                if (view.IsOk()) DoNotOptimize(view.Data());
+                p += view.Size();
+            }
+            DoNotOptimize(errors);
+        });
+        runner.Run(name + ", ResultView::Parse", [&](std::uint64_t) {
+            std::size_t errors = 0;
+            for (const auto *p = buffer.data(); p != end;) {
+                auto parsed = ResultView<T>::Parse(p, static_cast<std::size_t>(end - p));
+                if (parsed.IsErr()) break;
+                const auto &view = parsed.Data();
+                errors += view.IsErr();
+                if (view.IsOk()) DoNotOptimize(view.Data());
+                p += view.Size();
+            }
+            DoNotOptimize(errors);
+        });
+        runner.Run(name + ", decoded into Result", [&](std::uint64_t) {
+            std::size_t errors = 0;
+            for (const auto *p = buffer.data(); p != end;) {
+                ResultView<T> view(p);
+                auto result = view.ToResult();
+                errors += result.IsErr();
+                DoNotOptimize(result);
+                p += view.Size();
+            }
+            DoNotOptimize(errors);
+        });
+    }
+}// namespace
+
+int main(int argc, const char **argv) {
+    Runner runner(argc, argv);
+    std::printf("every measurement covers %zu records\n", kRecords);
+
+    auto ints = MakeResults<int>(100, [](std::size_t i) { return static_cast<int>(i); });
+    auto doubles = MakeResults<double>(10, [](std::size_t i) { return static_cast<double>(i) * 0.5; });
+    auto strings = MakeResults<std::string>(100, [](std::size_t i) { return "payload of record " + std::to_string(i); });
+
+    Section("encode");
+    RunEncode(runner, "Result<int>, 1% Err", ints);
+    RunEncode(runner, "Result<double>, 10% Err", doubles);
+    RunEncode(runner, "Result<std::string>, 1% Err", strings);
+
+    Section("scan for errors");
+    RunScan(runner, "Result<int>, 1% Err", ints);
+    RunScan(runner, "Result<double>, 10% Err", doubles);
+    RunScan(runner, "Result<std::string>, 1% Err", strings);
+    return runner.Finish();
+}
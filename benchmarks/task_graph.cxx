@@ -0,0 +1,76 @@
+// Scheduling overhead of TaskGraph per node, on graphs whose nodes do almost nothing: a wide graph (one root fanning
+// out to many leaves), a deep one (a single chain), and the same chain with its root failing so that every other node
+// is skipped. Reported from one worker to all cores, against calling the same steps in a plain loop.
+#include <TaskGraph.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "runner.hxx"
+
+using resultpp::bench::DoNotOptimize;
+using resultpp::bench::Runner;
+using resultpp::bench::Section;
+using resultpp::bench::Unpin;
+
+namespace {
+    using Result = resultpp::Result<std::uint64_t>;
+
+    constexpr int kNodes = 20'000;
+    constexpr int kRuns = 15;
+
+    Result Step(std::uint64_t x) { return Result(x * 2654435761U + 1); }
+
+    void BuildWide(resultpp::TaskGraph<> &graph) {
+        auto root = graph.Add([] { return Step(1); });
+        for (int i = 1; i < kNodes; ++i) graph.Add([](const std::uint64_t &x) { return Step(x); }, root);
+    }
+
+    void BuildDeep(resultpp::TaskGraph<> &graph, bool failRoot) {
+        auto node = graph.Add([failRoot] { return failRoot ? Result(0, std::string("root failed")) : Step(1); });
+        for (int i = 1; i < kNodes; ++i) node = graph.Add([](const std::uint64_t &x) { return Step(x); }, node);
+    }
+
+    /**
+     * @brief Median nanoseconds per node of `kRuns` runs of `graph`.
+     */
+    double PerNodeNs(resultpp::TaskGraph<> &graph, unsigned workers) {
+        resultpp::Executor executor(workers);
+        std::vector<double> samples;
+        for (int run = 0; run < kRuns; ++run) {
+            auto start = std::chrono::steady_clock::now();
+            DoNotOptimize(graph.Run(executor));
+            samples.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / kNodes);
+        }
+        std::sort(samples.begin(), samples.end());
+        return samples[samples.size() / 2];
+    }
+}// namespace
+
+int main(int argc, const char **argv) {
+    Runner runner(argc, argv);
+
+    Section("the same steps in a plain loop, per node");
+    runner.Run("one Step call", [](std::uint64_t i) { DoNotOptimize(Step(i)); });
+
+    Unpin();
+    auto cores = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<unsigned> counts;
+    for (unsigned workers = 1; workers < cores; workers *= 2) counts.push_back(workers);
+    counts.push_back(cores);
+
+    resultpp::TaskGraph<> wide, deep, skipped;
+    BuildWide(wide);
+    BuildDeep(deep, false);
+    BuildDeep(skipped, true);
+
+    Section("TaskGraph::Run, ns per node (20000 nodes)");
+    for (auto workers : counts) {
+        std::printf("%2u worker(s): wide %8.2f   deep %8.2f   deep, root failed (skips) %8.2f\n", workers,
+                    PerNodeNs(wide, workers), PerNodeNs(deep, workers), PerNodeNs(skipped, workers));
+    }
+    return runner.Finish();
+}
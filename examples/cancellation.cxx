@@ -0,0 +1,38 @@
+#include <Parallel.hxx>
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// A parallel job validating records: the first bad record settles the job and cancels the source, so most records
+// are never looked at, and a callback registered on the token hears about it.
+int main() {
+#if RESULTPP_HAS_ATOMIC_WAIT
+    using resultpp::Result;
+
+    resultpp::Executor pool(4);
+    std::vector<int> records(100'000);
+    for (int i = 0; i < static_cast<int>(records.size()); ++i) records[i] = i;
+
+    resultpp::CancellationSource source;
+    std::atomic<int> checked{0};
+    auto registration = source.Token().OnCancel([] { std::printf("job cancelled\n"); });
+    auto result = resultpp::ParallelTransform(
+                          pool, records,
+                          [&](int record) {
+                              checked.fetch_add(1, std::memory_order_relaxed);
+                              if (record == 10) return Result<int>(0, std::string("bad record 10"));
+                              return Result<int>(record);
+                          },
+                          source)
+                          .Get();
+    std::printf("%s after checking %d of %zu records\n", result.Message().c_str(), checked.load(), records.size());
+
+    auto skipped = pool.Submit(source.Token(), [] { return 1; }).Get();
+    std::printf("a task submitted afterwards: %s\n", resultpp::IsCancelled(skipped) ? "cancelled" : "ran");
+#else
+    std::printf("std::atomic::wait is not available; nothing to run\n");
+#endif
+    return 0;
+}
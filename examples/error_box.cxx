@@ -0,0 +1,47 @@
+#include <ErrorBox.hxx>
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+// One Result type for an application layer carrying structured errors from several lower layers in an ErrorBox; the
+// caller recovers the concrete type with As<E>() and handles each kind of failure on its own terms.
+namespace {
+    struct ParseError {
+        int line;
+        int column;
+    };
+
+    struct QuotaError {
+        std::string tenant;
+        long long used;
+        long long limit;
+    };
+
+    using Result = resultpp::Result<int, resultpp::ErrorBox>;
+
+    Result Handle(int request) {
+        switch (request) {
+            case 0: return Result(0, ParseError{3, 14});
+            case 1: return Result(0, QuotaError{"acme", 250, 100});
+            case 2: return Result(0, std::runtime_error("missing listen address"));
+            default: return Result(request * 10);
+        }
+    }
+}// namespace
+
+int main() {
+    for (int request = 0; request < 4; ++request) {
+        auto result = Handle(request);
+        if (const auto *parse = result.Message().As<ParseError>()) {
+            std::printf("parse error at %d:%d\n", parse->line, parse->column);
+        } else if (const auto *quota = result.Message().As<QuotaError>()) {
+            std::printf("%s is over quota: %lld of %lld\n", quota->tenant.c_str(), quota->used, quota->limit);
+        } else if (result.IsErr()) {
+            std::printf("error: %s\n", result.Describe().c_str());
+        } else {
+            std::printf("ok: %d\n", result.Data());
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,39 @@
+#include <ErrorCode.hxx>
+
+#include <cstdio>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Results failing with std::error_code at the system call boundary: a failed open() becomes an Err carrying errno,
+// which the caller compares against std::errc without formatting anything, rendering the text only to print it.
+namespace {
+    resultpp::SystemResult<int> Open(const char *path) {
+#if defined(__unix__) || defined(__APPLE__)
+        return resultpp::CheckSyscall(::open(path, O_RDONLY));
+#else
+        static_cast<void>(path);
+        return resultpp::ErrcErr<int>(std::errc::no_such_file_or_directory);
+#endif
+    }
+}// namespace
+
+int main() {
+    for (const char *path : {".", "/resultpp/does/not/exist"}) {
+        auto fd = Open(path);
+        if (resultpp::ErrorIs(fd, std::errc::no_such_file_or_directory)) {
+            std::printf("%s: missing (%s)\n", path, fd.Describe().c_str());
+        } else if (fd.IsErr()) {
+            std::printf("%s: %s\n", path, fd.Describe().c_str());
+        } else {
+            std::printf("%s: opened\n", path);
+#if defined(__unix__) || defined(__APPLE__)
+            ::close(fd.Data());
+#endif
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include <ErrorRegistry.hxx>
+
+#include <cstdint>
+#include <cstdio>
+
+// Error codes that stay small integers in Results but print rich messages: a registered enum with sparse values,
+// whose message, severity and category are looked up in a table built at compile time.
+namespace {
+    enum class StoreError : std::uint16_t {
+        None = 0,
+        NotFound = 404,
+        Conflict = 409,
+        DiskFull = 28'000,
+    };
+}// namespace
+
+template<>
+struct resultpp::ErrorRegistry<StoreError> {
+    static constexpr std::string_view category = "store";
+    static constexpr ErrorEntry<StoreError> entries[] = {
+            {StoreError::NotFound, "key not found", ErrorSeverity::Info},
+            {StoreError::Conflict, "write conflict", ErrorSeverity::Warning},
+            {StoreError::DiskFull, "no space left on the data volume", ErrorSeverity::Fatal},
+    };
+};
+
+namespace {
+    resultpp::Result<int, StoreError> Read(int key) {
+        if (key < 0) return resultpp::Result<int, StoreError>(0, StoreError::NotFound);
+        if (key > 1000) return resultpp::Result<int, StoreError>(0, StoreError::DiskFull);
+        return resultpp::Result<int, StoreError>(key * 2);
+    }
+
+    const char *Name(resultpp::ErrorSeverity severity) {
+        switch (severity) {
+            case resultpp::ErrorSeverity::Info: return "info";
+            case resultpp::ErrorSeverity::Warning: return "warning";
+            case resultpp::ErrorSeverity::Error: return "error";
+            case resultpp::ErrorSeverity::Fatal: return "fatal";
+        }
+        return "?";
+    }
+}// namespace
+
+int main() {
+    for (int key : {-1, 7, 5000}) {
+        auto result = Read(key);
+        if (result.IsOk()) {
+            std::printf("key %5d: %d\n", key, result.Data());
+            continue;
+        }
+        auto category = resultpp::CategoryOf(result.Message());
+        auto message = result.Describe();
+        std::printf("key %5d: [%.*s/%s] %.*s\n", key, static_cast<int>(category.size()), category.data(),
+                    Name(resultpp::SeverityOf(result.Message())), static_cast<int>(message.size()), message.data());
+    }
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include <Interop.hxx>
+#include <resultpp.hxx>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <utility>
+
+// Round-trips a Result through std::optional, std::variant and, when available, std::expected. Every conversion from
+// an rvalue moves the payload, so move-only payloads such as std::unique_ptr convert as well.
+int main() {
+    resultpp::Result<std::unique_ptr<std::string>> config(std::make_unique<std::string>("listen=:8080"));
+
+    auto optional = resultpp::ToOptional(std::move(config));
+    std::printf("std::optional holds a value: %s\n", optional.has_value() ? "yes" : "no");
+
+    auto variant = resultpp::ToVariant(resultpp::FromOptional(std::move(optional), std::string("no config")));
+    std::printf("std::variant index: %zu\n", variant.index());
+
+    resultpp::Result<std::unique_ptr<std::string>> back = std::move(variant);
+#if RESULTPP_HAS_EXPECTED
+    auto expected = resultpp::ToExpected(std::move(back));
+    std::printf("std::expected has a value: %s\n", expected.has_value() ? "yes" : "no");
+    back = resultpp::FromExpected(std::move(expected));
+
+    std::expected<int, std::string> failed = std::unexpected(std::string("disk full"));
+    resultpp::Result<int> err = std::move(failed);
+    std::printf("std::expected error as a Result: %s\n", err.Message().c_str());
+#endif
+    std::printf("back in a Result: %s\n", back.IsOk() ? back.Data()->c_str() : back.Message().c_str());
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include <resultpp.hxx>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Results over payloads that cannot be copied: a std::unique_ptr and a move-only file handle flow through Map,
+// FlatMap and Or on rvalues, each stage taking the payload over from the one before.
+namespace {
+    /**
+     * @brief Move-only owner of a file descriptor, standing in for handles that must never be duplicated.
+     */
+    class UniqueFd {
+        int _fd = -1;
+
+    public:
+        UniqueFd() = default;
+        explicit UniqueFd(int fd) : _fd(fd) {}
+        UniqueFd(UniqueFd &&other) noexcept : _fd(std::exchange(other._fd, -1)) {}
+        UniqueFd &operator=(UniqueFd &&other) noexcept {
+            _fd = std::exchange(other._fd, -1);
+            return *this;
+        }
+        UniqueFd(const UniqueFd &) = delete;
+        UniqueFd &operator=(const UniqueFd &) = delete;
+
+        [[nodiscard]] int Get() const noexcept { return _fd; }
+    };
+
+    resultpp::Result<UniqueFd> Open(int fd) {
+        if (fd < 0) return resultpp::Result<UniqueFd>(UniqueFd{}, std::string("no such descriptor"));
+        return resultpp::Result<UniqueFd>(UniqueFd(fd));
+    }
+
+    resultpp::Result<std::vector<int>> ReadAll(UniqueFd &&fd) {
+        return resultpp::Result<std::vector<int>>(std::vector<int>(4, fd.Get()));
+    }
+}// namespace
+
+int main() {
+    auto buffer = resultpp::Result<std::unique_ptr<int>>(std::make_unique<int>(21))
+                          .Map([](std::unique_ptr<int> &&p) {
+                              *p *= 2;
+                              return std::move(p);
+                          })
+                          .Unwrap();
+    std::printf("unique_ptr through Map: %d\n", *buffer);
+
+    for (int fd : {3, -1}) {
+        auto bytes = Open(fd).FlatMap(ReadAll).Or(resultpp::Result<std::vector<int>>(std::vector<int>{}));
+        std::printf("descriptor %2d: %zu value(s)\n", fd, bytes.Data().size());
+    }
+    return 0;
+}
@@ -0,0 +1,40 @@
+#include <SharedResult.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+// Several threads need one expensive, fallible initialisation: the first to call GetOrInit runs it, the others block
+// until the Result is published and then read the same object.
+int main() {
+#if RESULTPP_HAS_ATOMIC_WAIT
+    using Model = std::vector<float>;
+
+    resultpp::OnceResult<Model> model;
+    std::atomic<int> loads{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&] {
+            const auto &result = model.GetOrInit([&] {
+                loads.fetch_add(1);
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                return resultpp::Result<Model>(Model(1024, 0.5f));
+            });
+            static_cast<void>(result);
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    std::printf("model loaded %d time(s), %zu weights\n", loads.load(), model.Get().Data().size());
+
+    resultpp::SharedResult<int> shard;
+    auto reader = shard;
+    std::thread writer([shard]() mutable { shard.Set(resultpp::Result<int>(0, std::string("shard 3 is offline"))); });
+    std::printf("reader sees: %s\n", reader.Get().Message().c_str());
+    writer.join();
+#else
+    std::printf("std::atomic::wait is not available; nothing to run\n");
+#endif
+    return 0;
+}
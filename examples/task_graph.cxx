@@ -0,0 +1,51 @@
+#include <TaskGraph.hxx>
+
+#include <cstdio>
+#include <string>
+
+// A small batch job as a TaskGraph: load, then two independent transforms, then a join. One branch fails, and every
+// node downstream of it is skipped with the failing node's error while the independent branch still runs.
+namespace {
+    const char *Name(resultpp::NodeStatus status) {
+        switch (status) {
+            case resultpp::NodeStatus::Pending: return "pending";
+            case resultpp::NodeStatus::Ok: return "ok";
+            case resultpp::NodeStatus::Failed: return "failed";
+            case resultpp::NodeStatus::Skipped: return "skipped";
+        }
+        return "?";
+    }
+}// namespace
+
+int main() {
+#if RESULTPP_HAS_ATOMIC_WAIT
+    using resultpp::Result;
+
+    resultpp::Executor pool(4);
+    resultpp::TaskGraph<> job;
+
+    auto load = job.Add([] { return std::string("3,1,2"); });
+    auto count = job.Add([](const std::string &csv) { return static_cast<int>(csv.size() + 1) / 2; }, load);
+    auto checksum = job.Add([](const std::string &csv) {
+        int sum = 0;
+        for (char c : csv) sum += c == ',' ? 0 : c - '0';
+        return sum;
+    }, load);
+    auto report = job.Add([](const int &n, const int &sum) { return std::to_string(sum) + "/" + std::to_string(n); }, count, checksum);
+
+    auto validate = job.Add([](const std::string &csv) {
+        return csv.find('0') == std::string::npos ? Result<bool>(false, std::string("no sentinel row"))
+                                                  : Result<bool>(true);
+    }, load);
+    auto publish = job.Add([](const bool &, const std::string &text) { return text; }, validate, report);
+
+    auto summary = job.Run(pool);
+    std::printf("report:   %s (%s)\n", job.Get(report).Data().c_str(), Name(job.Status(report)));
+    std::printf("validate: %s (%s)\n", job.Get(validate).Message().c_str(), Name(job.Status(validate)));
+    std::printf("publish:  %s (%s)\n", job.Get(publish).Message().c_str(), Name(job.Status(publish)));
+    std::printf("%zu ok, %zu failed, %zu skipped\n", summary.ok, summary.failed, summary.skipped);
+#else
+    std::printf("std::atomic::wait is not available; nothing to run\n");
+#endif
+    return 0;
+}
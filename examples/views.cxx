@@ -0,0 +1,42 @@
+#include <Views.hxx>
+
+#include <cstdio>
+#include <ranges>
+#include <string>
+#include <vector>
+
+// Parses a batch of lines into Results, then uses resultpp::views inside std::views pipelines to sum the numbers,
+// list the errors and validate what was parsed.
+namespace {
+    resultpp::Result<int> Parse(const std::string &text) {
+        if (text.empty() || text.size() > 9 || text.find_first_not_of("0123456789") != std::string::npos)
+            return resultpp::Result<int>(0, "not a number: '" + text + "'");
+        return resultpp::Result<int>(std::stoi(text));
+    }
+}// namespace
+
+int main() {
+#if RESULTPP_HAS_RANGES
+    using resultpp::Result;
+    namespace views = resultpp::views;
+
+    std::vector<Result<int>> parsed;
+    for (const char *line : {"12", "x7", "40", "", "5"}) parsed.push_back(Parse(line));
+
+    int sum = 0;
+    for (int value : parsed | views::ok_values) sum += value;
+    std::printf("sum of the numbers: %d\n", sum);
+
+    for (const std::string &error : parsed | views::errors | std::views::take(2)) std::printf("error: %s\n", error.c_str());
+
+    auto checked = parsed | views::transform_ok([](int v) {
+                       return v > 20 ? Result<int>(0, std::string("too large")) : Result<int>(v);
+                   });
+    for (const auto &result : checked) {
+        if (result.IsOk()) std::printf("accepted %d\n", result.Data());
+    }
+#else
+    std::printf("std::ranges is not available; nothing to run\n");
+#endif
+    return 0;
+}
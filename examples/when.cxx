@@ -0,0 +1,65 @@
+#include <When.hxx>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+// Fans three lookups out to threads and joins them with WhenAll, then races replicas with WhenAny, cancelling the
+// slow ones once a winner is known.
+namespace {
+    std::vector<std::thread> workers;
+
+    /**
+     * @brief Run `body()` on a new thread and return the future of its Result; the threads are joined at the end.
+     */
+    template<typename T, typename F>
+    resultpp::ResultFuture<T> Spawn(F body) {
+        resultpp::ResultPromise<T> promise;
+        auto future = promise.GetFuture();
+        workers.emplace_back([promise = std::move(promise), body]() mutable { promise.Set(body()); });
+        return future;
+    }
+
+    /**
+     * @brief A slow replica that gives up as soon as `token` is cancelled.
+     */
+    resultpp::Result<int> Slow(const resultpp::CancellationToken &token, int value) {
+        for (int i = 0; i < 200; ++i) {
+            if (token.IsCancelled()) return resultpp::Result<int>(0, std::string("cancelled"));
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return resultpp::Result<int>(value);
+    }
+}// namespace
+
+int main() {
+#if RESULTPP_HAS_ATOMIC_WAIT
+    using resultpp::Result;
+
+    auto profile = resultpp::WhenAll(Spawn<std::string>([] { return Result<std::string>(std::string("ada")); }),
+                                     Spawn<int>([] { return Result<int>(36); }),
+                                     Spawn<double>([] { return Result<double>(4.5); }))
+                           .Get();
+    if (profile.IsOk()) {
+        const auto &[name, age, rating] = profile.Data();
+        std::printf("WhenAll: %s, %d, %.1f\n", name.c_str(), age, rating);
+    }
+
+    resultpp::CancellationSource source;
+    auto token = source.Token();
+    std::vector<resultpp::ResultFuture<int>> replicas;
+    replicas.push_back(Spawn<int>([token] { return Slow(token, 1); }));
+    replicas.push_back(Spawn<int>([] { return Result<int>(0, std::string("replica 2 unreachable")); }));
+    replicas.push_back(Spawn<int>([] { return Result<int>(3); }));
+    auto fastest = resultpp::WhenAny(replicas, source).Get();
+    std::printf("WhenAny: %d, losers cancelled: %s\n", fastest.Data(), source.IsCancelled() ? "yes" : "no");
+
+    for (auto &worker : workers) worker.join();
+#else
+    std::printf("std::atomic::wait is not available; nothing to run\n");
+#endif
+    return 0;
+}
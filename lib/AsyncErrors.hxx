@@ -0,0 +1,47 @@
+#ifndef RESULTPP_ASYNC_ERRORS_HXX
+#define RESULTPP_ASYNC_ERRORS_HXX
+
+#include <type_traits>// std::enable_if_t, std::is_constructible_v
+
+namespace resultpp {
+    /**
+     * @struct AsyncErrors
+     * @brief Errors the asynchronous types report for failures that no user code produced.
+     *
+     * Provided for error types constructible from a message. Specialise it to use futures, executors and
+     * cancellation with other error types, such as error codes:
+     *
+     * @code
+     * template<> struct resultpp::AsyncErrors<Code> {
+     *     static Code BrokenPromise() { return Code::Internal; }
+     *     static Code Exception(const char *) { return Code::Internal; }
+     *     static Code Cancelled() { return Code::Cancelled; }
+     * };
+     * @endcode
+     */
+    template<typename E, typename = void>
+    struct AsyncErrors;
+
+    template<typename E>
+    struct AsyncErrors<E, std::enable_if_t<std::is_constructible_v<E, const char *>>> {
+        /**
+         * @brief Error of a future whose promise was destroyed without being set.
+         */
+        static E BrokenPromise() { return E("resultpp: broken promise"); }
+
+        /**
+         * @brief Error of a task that threw, on an executor that turns exceptions into errors.
+         */
+        static E Exception(const char *what) { return E(what); }
+
+        /**
+         * @brief Error of work skipped or stopped because its `CancellationToken` was cancelled.
+         *
+         * `IsCancelled(result)` recognises it by comparing messages, so a failure of user code with the same text
+         * is taken for a cancellation.
+         */
+        static E Cancelled() { return E("resultpp: cancelled"); }
+    };
+}// namespace resultpp
+
+#endif//RESULTPP_ASYNC_ERRORS_HXX
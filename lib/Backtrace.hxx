@@ -0,0 +1,234 @@
+#ifndef RESULTPP_BACKTRACE_HXX
+#define RESULTPP_BACKTRACE_HXX
+
+#include <atomic>  // std::atomic
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <cstdio>  // std::FILE, std::fprintf
+#include <cstdlib> // std::free
+#include <cstring> // std::memcpy
+#include <string>  // std::string
+
+#include <cxxabi.h> // abi::__cxa_demangle
+#include <dlfcn.h>  // dladdr
+#include <unwind.h> // _Unwind_Backtrace
+
+namespace resultpp {
+    /**
+     * @brief Maximum number of frames kept for a single captured backtrace.
+     */
+    inline constexpr std::size_t kBacktraceMaxFrames = 32;
+
+    /**
+     * @brief Number of backtraces retained per thread. Older records are overwritten.
+     */
+    inline constexpr std::size_t kBacktraceSlots = 16;
+
+    /**
+     * @brief Maximum number of message bytes copied into a record (including the terminator).
+     */
+    inline constexpr std::size_t kBacktraceMessageBytes = 64;
+
+    /**
+     * @struct BacktraceRecord
+     * @brief Raw, unsymbolized backtrace captured when an Err was constructed.
+     */
+    struct BacktraceRecord {
+        std::uint64_t sequence = 0;///< Ordinal of the error on the capturing thread.
+        std::uint32_t depth = 0;   ///< Number of valid entries in `frames`.
+        void *frames[kBacktraceMaxFrames]{};
+        char message[kBacktraceMessageBytes]{};
+    };
+
+    /**
+     * @brief Predicate selecting errors that must always be captured, regardless of sampling.
+     */
+    using BacktraceFilter = bool (*)(const std::string &message);
+
+    namespace internal::backtrace {
+        inline std::atomic<std::uint32_t> sampleEvery{0};
+        inline std::atomic<BacktraceFilter> filter{nullptr};
+
+        struct ThreadBuffer {
+            BacktraceRecord records[kBacktraceSlots];
+            std::uint64_t seen = 0;    ///< Errors observed on this thread.
+            std::uint64_t captured = 0;///< Backtraces written on this thread.
+            std::uint32_t countdown = 0;
+        };
+
+        inline thread_local ThreadBuffer buffer;
+
+        struct UnwindState {
+            void **cursor;
+            void **end;
+            int skip;
+        };
+
+        inline _Unwind_Reason_Code UnwindFrame(_Unwind_Context *context, void *arg) {
+            auto *state = static_cast<UnwindState *>(arg);
+            if (state->skip > 0) {
+                --state->skip;
+                return _URC_NO_REASON;
+            }
+            if (state->cursor == state->end) return _URC_END_OF_STACK;
+
+            auto ip = _Unwind_GetIP(context);
+            if (ip == 0) return _URC_END_OF_STACK;
+            *state->cursor++ = reinterpret_cast<void *>(ip);
+            return _URC_NO_REASON;
+        }
+
+        /**
+         * @brief Walk the calling stack into `frames`, skipping `skip` innermost frames.
+         *
+         * Uses `_Unwind_Backtrace` by default. Defining `RESULTPP_BACKTRACE_FRAME_POINTERS` switches to a
+         * frame-pointer walk, which is several times faster but only valid when every frame on the stack
+         * was compiled with `-fno-omit-frame-pointer`.
+         *
+         * @return The number of frames written.
+         */
+        [[gnu::noinline]] inline std::uint32_t CaptureFrames(void **frames, std::uint32_t max, int skip) {
+#if defined(RESULTPP_BACKTRACE_FRAME_POINTERS)
+            constexpr std::uintptr_t kMaxFrameDistance = 1U << 20U;
+            auto **fp = static_cast<void **>(__builtin_frame_address(0));
+            std::uint32_t depth = 0;
+            while (fp != nullptr && depth < max) {
+                auto **next = static_cast<void **>(fp[0]);
+                void *ret = fp[1];
+                if (ret == nullptr) break;
+                if (skip > 0) --skip;
+                else frames[depth++] = ret;
+
+                auto distance = reinterpret_cast<std::uintptr_t>(next) - reinterpret_cast<std::uintptr_t>(fp);
+                if (next <= fp || distance > kMaxFrameDistance || (reinterpret_cast<std::uintptr_t>(next) & 7U) != 0) break;
+                fp = next;
+            }
+            return depth;
+#else
+            UnwindState state{frames, frames + max, skip + 1};
+            _Unwind_Backtrace(&UnwindFrame, &state);
+            return static_cast<std::uint32_t>(state.cursor - frames);
+#endif
+        }
+
+        [[gnu::noinline, gnu::cold]] inline void Record(const std::string &message) {
+            auto &record = buffer.records[buffer.captured % kBacktraceSlots];
+            record.sequence = buffer.seen;
+            record.depth = CaptureFrames(record.frames, kBacktraceMaxFrames, 1);
+
+            auto bytes = message.size() < kBacktraceMessageBytes ? message.size() : kBacktraceMessageBytes - 1;
+            std::memcpy(record.message, message.data(), bytes);
+            record.message[bytes] = '\0';
+            ++buffer.captured;
+        }
+
+        /**
+         * @brief Hook invoked for every Err construction. Decides whether the error is sampled.
+         *
+         * The skip path is a thread-local decrement and one relaxed load; only sampled or filtered errors
+         * pay for the stack walk.
+         */
+        inline void OnErr(const std::string &message) {
+            ++buffer.seen;
+
+            auto selected = filter.load(std::memory_order_relaxed);
+            if (selected != nullptr && selected(message)) return Record(message);
+
+            if (buffer.countdown > 1) {
+                --buffer.countdown;
+                return;
+            }
+
+            auto every = sampleEvery.load(std::memory_order_relaxed);
+            if (every == 0) return;
+            buffer.countdown = every;
+            Record(message);
+        }
+
+        inline void PrintFrame(std::FILE *out, std::size_t index, void *frame) {
+            Dl_info info{};
+            if (dladdr(frame, &info) == 0) {
+                std::fprintf(out, "    #%-2zu %p ??\n", index, frame);
+                return;
+            }
+
+            const char *module = info.dli_fname != nullptr ? info.dli_fname : "??";
+            if (info.dli_sname == nullptr) {
+                std::fprintf(out, "    #%-2zu %p ?? (%s)\n", index, frame, module);
+                return;
+            }
+
+            int status = 0;
+            char *demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+            auto offset = static_cast<std::size_t>(static_cast<char *>(frame) - static_cast<char *>(info.dli_saddr));
+            std::fprintf(out, "    #%-2zu %p %s+0x%zx (%s)\n", index, frame,
+                         status == 0 ? demangled : info.dli_sname, offset, module);
+            std::free(demangled);
+        }
+    }// namespace internal::backtrace
+
+    /**
+     * @brief Capture one backtrace for every `every` errors constructed on a thread.
+     * @param every The sampling period; `0` disables sampling, `1` captures every error.
+     */
+    inline void SetBacktraceSampling(std::uint32_t every) noexcept {
+        internal::backtrace::sampleEvery.store(every, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Always capture errors for which `filter` returns `true`; pass `nullptr` to clear.
+     */
+    inline void SetBacktraceFilter(BacktraceFilter filter) noexcept {
+        internal::backtrace::filter.store(filter, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Capture a backtrace of the calling site into the thread buffer, bypassing sampling.
+     */
+    [[gnu::noinline]] inline void CaptureBacktrace(const std::string &message = "") {
+        internal::backtrace::Record(message);
+    }
+
+    /**
+     * @brief Number of errors observed on the calling thread.
+     */
+    [[nodiscard]] inline std::uint64_t ErrorsSeen() noexcept { return internal::backtrace::buffer.seen; }
+
+    /**
+     * @brief Number of backtraces captured on the calling thread (including overwritten ones).
+     */
+    [[nodiscard]] inline std::uint64_t BacktracesCaptured() noexcept { return internal::backtrace::buffer.captured; }
+
+    /**
+     * @brief Visit the retained backtraces of the calling thread, oldest first.
+     * @param func Callable taking a `const BacktraceRecord &`.
+     */
+    template<typename F>
+    void ForEachBacktrace(F &&func) {
+        const auto &buffer = internal::backtrace::buffer;
+        auto first = buffer.captured > kBacktraceSlots ? buffer.captured - kBacktraceSlots : 0;
+        for (auto i = first; i < buffer.captured; ++i) func(buffer.records[i % kBacktraceSlots]);
+    }
+
+    /**
+     * @brief Drop the retained backtraces of the calling thread.
+     */
+    inline void ClearBacktraces() noexcept { internal::backtrace::buffer.captured = 0; }
+
+    /**
+     * @brief Symbolize and print the retained backtraces of the calling thread.
+     *
+     * Symbol names are resolved through `dladdr`, so only exported symbols are named; link executables
+     * with `-rdynamic` for complete traces.
+     *
+     * @param out The stream to write to.
+     */
+    inline void DumpBacktraces(std::FILE *out = stderr) {
+        ForEachBacktrace([out](const BacktraceRecord &record) {
+            std::fprintf(out, "error #%llu: %s\n", static_cast<unsigned long long>(record.sequence), record.message);
+            for (std::uint32_t i = 0; i < record.depth; ++i) internal::backtrace::PrintFrame(out, i, record.frames[i]);
+        });
+    }
+}// namespace resultpp
+
+#endif//RESULTPP_BACKTRACE_HXX
@@ -0,0 +1,232 @@
+#ifndef RESULTPP_CANCELLATION_HXX
+#define RESULTPP_CANCELLATION_HXX
+
+#include <atomic>            // std::atomic
+#include <condition_variable>// std::condition_variable
+#include <cstdint>           // std::uint64_t
+#include <deque>             // std::deque
+#include <functional>        // std::function
+#include <memory>            // std::shared_ptr, std::make_shared
+#include <mutex>             // std::lock_guard, std::mutex, std::unique_lock
+#include <thread>            // std::this_thread, std::thread
+#include <type_traits>       // std::conditional_t, std::decay_t, std::invoke_result_t
+#include <utility>           // std::forward, std::move, std::pair
+
+#include "AsyncErrors.hxx"
+#include "resultpp.hxx"
+
+namespace resultpp {
+    namespace internal::cancel {
+        /**
+         * @brief The flag, read on the hot path, and the callback list, only touched when registering or cancelling.
+         *
+         * As for `std::stop_callback`, callbacks run with `mutex` released, so that a callback may take other locks
+         * and register or unregister callbacks. The one being run is recorded with its thread, so that unregistering
+         * it from another thread waits until it returns, and unregistering it from inside itself does not.
+         */
+        struct State {
+            std::atomic<bool> cancelled{false};
+            mutable std::mutex mutex;
+            mutable std::condition_variable finished;
+            mutable std::deque<std::pair<std::uint64_t, std::function<void()>>> callbacks;
+            mutable std::uint64_t nextId = 1;
+            mutable std::uint64_t running = 0;
+            mutable std::thread::id runner;
+
+            void Unregister(std::uint64_t id) const {
+                std::unique_lock<std::mutex> lock(mutex);
+                for (auto it = callbacks.begin(); it != callbacks.end(); ++it) {
+                    if (it->first == id) {
+                        callbacks.erase(it);
+                        return;
+                    }
+                }
+                if (running == id && runner != std::this_thread::get_id()) {
+                    finished.wait(lock, [this, id] { return running != id; });
+                }
+            }
+
+            void RunCallbacks() {
+                std::unique_lock<std::mutex> lock(mutex);
+                runner = std::this_thread::get_id();
+                while (!callbacks.empty()) {
+                    auto callback = std::move(callbacks.front());
+                    callbacks.pop_front();
+                    running = callback.first;
+                    lock.unlock();
+                    callback.second();
+                    lock.lock();
+                    running = 0;
+                    finished.notify_all();
+                }
+            }
+        };
+    }// namespace internal::cancel
+
+    /**
+     * @class CancellationRegistration
+     * @brief Keeps a callback registered with `CancellationToken::OnCancel`; destroying it unregisters the callback,
+     * waiting for it to return if it is running on another thread. Destroying it from inside the callback does not
+     * wait.
+     */
+    class CancellationRegistration {
+        friend class CancellationToken;
+
+        std::shared_ptr<const internal::cancel::State> _state;
+        std::uint64_t _id = 0;
+
+        CancellationRegistration(std::shared_ptr<const internal::cancel::State> state, std::uint64_t id) noexcept
+            : _state(std::move(state)), _id(id) {}
+
+    public:
+        CancellationRegistration() = default;
+        CancellationRegistration(CancellationRegistration &&other) noexcept
+            : _state(std::move(other._state)), _id(std::exchange(other._id, 0)) {}
+        CancellationRegistration &operator=(CancellationRegistration &&other) noexcept {
+            if (this != &other) {
+                Reset();
+                _state = std::move(other._state);
+                _id = std::exchange(other._id, 0);
+            }
+            return *this;
+        }
+        ~CancellationRegistration() { Reset(); }
+
+        /**
+         * @brief Unregister the callback now.
+         */
+        void Reset() {
+            if (_state && _id != 0) _state->Unregister(_id);
+            _state.reset();
+            _id = 0;
+        }
+    };
+
+    /**
+     * @class CancellationToken
+     * @brief Read side of a `CancellationSource`, handed to the work that should stop early.
+     *
+     * A default-constructed token is never cancelled.
+     */
+    class CancellationToken {
+        friend class CancellationSource;
+
+        std::shared_ptr<const internal::cancel::State> _state;
+
+        explicit CancellationToken(std::shared_ptr<const internal::cancel::State> state) noexcept : _state(std::move(state)) {}
+
+    public:
+        CancellationToken() = default;
+
+        [[nodiscard]] bool CanBeCancelled() const noexcept { return _state != nullptr; }
+
+        /**
+         * @brief Whether cancellation was requested; a single relaxed load.
+         */
+        [[nodiscard]] bool IsCancelled() const noexcept {
+            return _state && _state->cancelled.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Call `callback()` once cancellation is requested: on the cancelling thread, or right away when it
+         * already was. The callback must not throw.
+         *
+         * No lock of the token is held while the callback runs. Dropping the registration on another thread while
+         * the callback runs waits for it to return, so do not drop it while holding a lock the callback takes.
+         * @return The registration keeping the callback; drop it to unregister.
+         */
+        template<typename F>
+        [[nodiscard]] CancellationRegistration OnCancel(F &&callback) const {
+            if (!_state) return {};
+            {
+                std::lock_guard<std::mutex> lock(_state->mutex);
+                if (!_state->cancelled.load(std::memory_order_relaxed)) {
+                    auto id = _state->nextId++;
+                    _state->callbacks.emplace_back(id, std::forward<F>(callback));
+                    return {_state, id};
+                }
+            }
+            std::forward<F>(callback)();
+            return {};
+        }
+    };
+
+    /**
+     * @class CancellationSource
+     * @brief Requests cancellation of the work holding its tokens. Copies share the same state.
+     */
+    class CancellationSource {
+        std::shared_ptr<internal::cancel::State> _state = std::make_shared<internal::cancel::State>();
+
+    public:
+        [[nodiscard]] CancellationToken Token() const noexcept { return CancellationToken(_state); }
+
+        [[nodiscard]] bool IsCancelled() const noexcept { return _state->cancelled.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Request cancellation, running the registered callbacks on this thread.
+         * @return Whether this call made the request, as opposed to an earlier one.
+         */
+        bool Cancel() {
+            if (_state->cancelled.exchange(true, std::memory_order_relaxed)) return false;
+            _state->RunCallbacks();
+            return true;
+        }
+    };
+
+    /**
+     * @brief The distinguished error of cancelled work, `AsyncErrors<E>::Cancelled()`, as a Result of type `R`.
+     */
+    template<typename R>
+    RESULTPP_COLD R Cancelled() {
+        return internal::MakeErr<R>(AsyncErrors<typename R::error_type>::Cancelled());
+    }
+
+    /**
+     * @brief Whether `result` holds the error of cancelled work rather than a failure of its own.
+     *
+     * The error is compared with `AsyncErrors<E>::Cancelled()`. For errors built from a message, that is a string
+     * comparison with "resultpp: cancelled", and a failure of the work with that very message counts as cancelled.
+     * Specialise `AsyncErrors` with an error value of your own to tell the two apart.
+     */
+    template<typename T, typename E>
+    [[nodiscard]] bool IsCancelled(const internal::ResultImpl<T, E> &result) {
+        return result.IsErr() && result.Message() == AsyncErrors<E>::Cancelled();
+    }
+
+    namespace internal::cancel {
+        template<typename F, typename... Args>
+        using invoke_result_t = std::decay_t<std::invoke_result_t<F &, Args...>>;
+
+        template<typename F, typename... Args>
+        using cancellable_result_t =
+                std::conditional_t<IsResult<invoke_result_t<F, Args...>>::value, invoke_result_t<F, Args...>,
+                                   ResultImpl<invoke_result_t<F, Args...>>>;
+
+        template<typename F>
+        struct Cancellable {
+            CancellationToken token;
+            F func;
+
+            template<typename... Args>
+            cancellable_result_t<F, Args &&...> operator()(Args &&...args) {
+                using result_t = cancellable_result_t<F, Args &&...>;
+                if (RESULTPP_UNLIKELY(token.IsCancelled())) return Cancelled<result_t>();
+                return result_t(func(std::forward<Args>(args)...));
+            }
+        };
+    }// namespace internal::cancel
+
+    /**
+     * @brief Wrap `func` so that, once `token` is cancelled, calling it returns `Cancelled<R>()` instead of running it.
+     *
+     * The wrapper takes the same arguments and returns a Result, wrapping a plain return value. It fits wherever a
+     * callable is expected: `ResultFuture::Then`, `Executor::Submit`, `AndThen`.
+     */
+    template<typename F>
+    internal::cancel::Cancellable<std::decay_t<F>> Cancellable(CancellationToken token, F &&func) {
+        return {std::move(token), std::forward<F>(func)};
+    }
+}// namespace resultpp
+
+#endif//RESULTPP_CANCELLATION_HXX
@@ -0,0 +1,243 @@
+#ifndef RESULTPP_ERROR_BOX_HXX
+#define RESULTPP_ERROR_BOX_HXX
+
+#include <cstddef>    // std::size_t
+#include <cstring>    // std::memcpy
+#include <new>        // std::launder
+#include <string>     // std::string
+#include <type_traits>// std::decay_t, std::enable_if_t, std::is_nothrow_move_constructible_v, std::is_same_v, ...
+#include <utility>    // std::forward, std::in_place_type_t, std::move
+
+#include "resultpp.hxx"
+
+namespace resultpp {
+    namespace internal::box {
+        /**
+         * @brief Identity of an error type, without RTTI: the address of a variable instantiated once per type.
+         */
+        using TypeId = const void *;
+
+        template<typename E>
+        struct TypeTag {
+            static constexpr char id = 0;
+        };
+
+        template<typename E>
+        constexpr TypeId IdOf() noexcept { return &TypeTag<E>::id; }
+
+        /**
+         * @brief Bytes of an `ErrorBox` available to store an error in place.
+         */
+        inline constexpr std::size_t kInlineSize = 3 * sizeof(void *);
+
+        /**
+         * @brief Whether `E` is stored in place; larger, over-aligned, or throwing-move types live on the heap.
+         */
+        template<typename E>
+        inline constexpr bool kInline = sizeof(E) <= kInlineSize && alignof(E) <= alignof(void *) &&
+                                        std::is_nothrow_move_constructible_v<E>;
+
+        /**
+         * @struct VTable
+         * @brief Operations on a boxed error; one static instance per type. Null `relocate` and `destroy` mean a
+         * plain copy of the bytes and nothing to do, which holds for trivial types and for every heap-stored one
+         * (the box only holds its pointer).
+         */
+        struct VTable {
+            TypeId type;
+            void (*relocate)(void *from, void *to) noexcept;
+            void (*destroy)(void *storage) noexcept;
+            void (*copy)(const void *from, void *to);
+            std::string (*describe)(const void *storage);
+        };
+
+        template<typename E, typename = void>
+        struct HasWhat : std::false_type {};
+
+        template<typename E>
+        struct HasWhat<E, std::void_t<decltype(std::declval<const E &>().what())>> : std::true_type {};
+
+        template<typename E>
+        std::string Describe(const E &error) {
+            if constexpr (HasWhat<E>::value) return std::string(error.what());
+            else return std::string(ErrorTraits<E>::Describe(error));
+        }
+
+        template<typename E>
+        struct Inline {
+            static E *Get(void *storage) noexcept { return std::launder(reinterpret_cast<E *>(storage)); }
+
+            static const E *Get(const void *storage) noexcept { return std::launder(reinterpret_cast<const E *>(storage)); }
+
+            template<typename... Args>
+            static void Create(void *storage, Args &&...args) { new (storage) E(std::forward<Args>(args)...); }
+
+            static void Relocate(void *from, void *to) noexcept {
+                new (to) E(std::move(*Get(from)));
+                Get(from)->~E();
+            }
+
+            static void Destroy(void *storage) noexcept { Get(storage)->~E(); }
+
+            static void Copy(const void *from, void *to) { new (to) E(*Get(from)); }
+
+            static constexpr bool kTrivial = std::is_trivially_copyable_v<E>;
+
+            static constexpr VTable kVTable = {
+                    IdOf<E>(),
+                    kTrivial ? nullptr : &Relocate,
+                    std::is_trivially_destructible_v<E> ? nullptr : &Destroy,
+                    &Copy,
+                    [](const void *storage) { return Describe(*Get(storage)); },
+            };
+        };
+
+        template<typename E>
+        struct Heap {
+            static E *Get(void *storage) noexcept { return *std::launder(reinterpret_cast<E **>(storage)); }
+
+            static const E *Get(const void *storage) noexcept { return *std::launder(reinterpret_cast<E *const *>(storage)); }
+
+            template<typename... Args>
+            static void Create(void *storage, Args &&...args) { new (storage) E *(new E(std::forward<Args>(args)...)); }
+
+            static void Destroy(void *storage) noexcept { delete Get(storage); }
+
+            static void Copy(const void *from, void *to) { Create(to, *Get(from)); }
+
+            static constexpr VTable kVTable = {
+                    IdOf<E>(),
+                    nullptr,
+                    &Destroy,
+                    &Copy,
+                    [](const void *storage) { return Describe(*Get(storage)); },
+            };
+        };
+
+        template<typename E>
+        using storage_t = std::conditional_t<kInline<E>, Inline<E>, Heap<E>>;
+    }// namespace internal::box
+
+    /**
+     * @class ErrorBox
+     * @brief An error of any copyable type, for application code where one `Result<T, ErrorBox>` has to carry
+     * structured errors from many layers without flattening them into strings.
+     *
+     * Errors of up to three pointers with a non-throwing move are stored in place; larger ones are allocated. Each
+     * stored type gets one static table of operations, so the box is a table pointer and the storage, and moving it
+     * copies those bytes unless the stored type has a non-trivial move. `Is<E>()` and `As<E>()` compare the table's
+     * type id, the address of a per-type variable, instead of using RTTI.
+     *
+     * An empty box is no error; a Result holding a box that holds anything is an 'Err'. Type ids are per program
+     * image: an error boxed in one shared library is not recognised by `Is` in another unless the type's tag is
+     * exported from a single one.
+     */
+    class ErrorBox {
+        const internal::box::VTable *_vtable = nullptr;
+        alignas(void *) unsigned char _storage[internal::box::kInlineSize];
+
+        template<typename E>
+        using enable_error_t = std::enable_if_t<!std::is_same_v<std::decay_t<E>, ErrorBox> &&
+                                                !std::is_same_v<std::decay_t<E>, const char *>>;
+
+    public:
+        ErrorBox() noexcept = default;
+
+        /**
+         * @brief Box `error`, moving or copying it in place or onto the heap.
+         */
+        template<typename E, typename = enable_error_t<E>>
+        ErrorBox(E &&error) : ErrorBox(std::in_place_type<std::decay_t<E>>, std::forward<E>(error)) {}
+
+        /**
+         * @brief Box a message as a `std::string`.
+         */
+        ErrorBox(const char *message) : ErrorBox(std::in_place_type<std::string>, message) {}
+
+        /**
+         * @brief Box an `E` constructed from `args`.
+         */
+        template<typename E, typename... Args>
+        explicit ErrorBox(std::in_place_type_t<E>, Args &&...args) {
+            static_assert(std::is_copy_constructible_v<E>, "a boxed error must be copyable");
+            internal::box::storage_t<E>::Create(_storage, std::forward<Args>(args)...);
+            _vtable = &internal::box::storage_t<E>::kVTable;
+        }
+
+        ErrorBox(const ErrorBox &other) {
+            if (other._vtable == nullptr) return;
+            other._vtable->copy(other._storage, _storage);
+            _vtable = other._vtable;
+        }
+
+        ErrorBox(ErrorBox &&other) noexcept { Take(other); }
+
+        ErrorBox &operator=(const ErrorBox &other) {
+            if (this != &other) *this = ErrorBox(other);
+            return *this;
+        }
+
+        ErrorBox &operator=(ErrorBox &&other) noexcept {
+            if (this != &other) {
+                Reset();
+                Take(other);
+            }
+            return *this;
+        }
+
+        ~ErrorBox() { Reset(); }
+
+        [[nodiscard]] bool Empty() const noexcept { return _vtable == nullptr; }
+
+        /**
+         * @brief Whether the box holds an `E`; exact type only, a derived error is not an `E`.
+         */
+        template<typename E>
+        [[nodiscard]] bool Is() const noexcept {
+            return _vtable != nullptr && _vtable->type == internal::box::IdOf<E>();
+        }
+
+        /**
+         * @brief The boxed `E`, or null when the box holds something else.
+         */
+        template<typename E>
+        [[nodiscard]] const E *As() const noexcept {
+            return Is<E>() ? internal::box::storage_t<E>::Get(static_cast<const void *>(_storage)) : nullptr;
+        }
+
+        template<typename E>
+        [[nodiscard]] E *As() noexcept {
+            return Is<E>() ? internal::box::storage_t<E>::Get(static_cast<void *>(_storage)) : nullptr;
+        }
+
+        /**
+         * @brief The boxed error as text: its `what()` when it has one, otherwise `ErrorTraits<E>::Describe`.
+         */
+        [[nodiscard]] std::string Describe() const { return _vtable ? _vtable->describe(_storage) : std::string(); }
+
+        void Reset() noexcept {
+            if (_vtable != nullptr && _vtable->destroy != nullptr) _vtable->destroy(_storage);
+            _vtable = nullptr;
+        }
+
+    private:
+        void Take(ErrorBox &other) noexcept {
+            if (other._vtable == nullptr) return;
+            if (other._vtable->relocate == nullptr) std::memcpy(_storage, other._storage, sizeof(_storage));
+            else other._vtable->relocate(other._storage, _storage);
+            _vtable = other._vtable;
+            other._vtable = nullptr;
+        }
+    };
+
+    namespace internal {
+        template<>
+        struct ErrorTraits<ErrorBox> {
+            static bool IsError(const ErrorBox &error) noexcept { return !error.Empty(); }
+
+            static std::string Describe(const ErrorBox &error) { return error.Describe(); }
+        };
+    }// namespace internal
+}// namespace resultpp
+
+#endif//RESULTPP_ERROR_BOX_HXX
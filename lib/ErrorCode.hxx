@@ -0,0 +1,111 @@
+#ifndef RESULTPP_ERROR_CODE_HXX
+#define RESULTPP_ERROR_CODE_HXX
+
+#include <cerrno>      // errno
+#include <future>      // std::future_errc
+#include <string>      // std::string
+#include <system_error>// std::errc, std::error_category, std::error_code, std::system_category
+#include <type_traits> // std::enable_if_t, std::is_error_code_enum_v, std::is_error_condition_enum_v
+
+#include "AsyncErrors.hxx"
+#include "resultpp.hxx"
+
+namespace resultpp {
+    namespace internal {
+        /**
+         * @brief `std::error_code` errors: an error is any non-zero value, as for `if (ec)`, whatever its category.
+         *
+         * The code is two words and trivially copyable, so an 'Err' costs no allocation; the message is only
+         * rendered, through the category, when something asks for a description (`Describe`, `Unwrap`).
+         */
+        template<>
+        struct ErrorTraits<std::error_code> {
+            static bool IsError(const std::error_code &error) noexcept { return static_cast<bool>(error); }
+
+            static std::string Describe(const std::error_code &error) {
+                return std::string(error.category().name()) + ": " + error.message();
+            }
+        };
+    }// namespace internal
+
+    /**
+     * @brief A Result failing with a `std::error_code`, for code at the system call boundary.
+     */
+    template<typename T>
+    using SystemResult = Result<T, std::error_code>;
+
+    /**
+     * @brief An 'Err' holding `error` (by default the current `errno`) in the system category. A zero `errno`, left by
+     * a call that failed without setting it, would be success; it becomes `std::errc::io_error` so that the result
+     * stays an 'Err'.
+     */
+    template<typename T>
+    RESULTPP_COLD SystemResult<T> ErrnoErr(int error = errno) noexcept {
+        if (error == 0) return SystemResult<T>(T{}, std::make_error_code(std::errc::io_error));
+        return SystemResult<T>(T{}, std::error_code(error, std::system_category()));
+    }
+
+    /**
+     * @brief An 'Err' holding `error` in the generic category.
+     */
+    template<typename T>
+    RESULTPP_COLD SystemResult<T> ErrcErr(std::errc error) noexcept {
+        return SystemResult<T>(T{}, std::make_error_code(error));
+    }
+
+    /**
+     * @brief Wrap the return value of a call reporting failure as `-1` and `errno`, such as `open`, `read` or
+     * `write`: 'Ok' with the value, or an 'Err' with the `errno` of the failure (`std::errc::io_error` if it is zero).
+     *
+     * @code
+     * resultpp::SystemResult<int> fd = resultpp::CheckSyscall(::open(path, O_RDONLY));
+     * @endcode
+     */
+    template<typename T>
+    SystemResult<T> CheckSyscall(T value) noexcept {
+        if (RESULTPP_UNLIKELY(value == T(-1))) return ErrnoErr<T>(errno);
+        return SystemResult<T>(value);
+    }
+
+    /**
+     * @brief Whether `result` failed with an error equivalent to `condition`, an error condition or code enum such as
+     * `std::errc`; compared through the categories, so `ENOENT` from the system category matches
+     * `std::errc::no_such_file_or_directory`.
+     */
+    template<typename T, typename Condition,
+             typename = std::enable_if_t<std::is_error_condition_enum_v<Condition> || std::is_error_code_enum_v<Condition>>>
+    [[nodiscard]] bool ErrorIs(const SystemResult<T> &result, Condition condition) noexcept {
+        return result.IsErr() && result.Message() == condition;
+    }
+
+    /**
+     * @brief Whether `result` failed with exactly `code`: the same category and the same value.
+     */
+    template<typename T>
+    [[nodiscard]] bool ErrorIs(const SystemResult<T> &result, const std::error_code &code) noexcept {
+        return result.IsErr() && result.Message() == code;
+    }
+
+    /**
+     * @brief Whether `result` failed with an error of `category`.
+     */
+    template<typename T>
+    [[nodiscard]] bool ErrorIn(const SystemResult<T> &result, const std::error_category &category) noexcept {
+        return result.IsErr() && result.Message().category() == category;
+    }
+
+    /**
+     * @brief Errors of the asynchronous types as error codes, so that futures and executors work with
+     * `SystemResult`. A task that threw loses its message and reports `std::errc::state_not_recoverable`.
+     */
+    template<>
+    struct AsyncErrors<std::error_code> {
+        static std::error_code BrokenPromise() { return std::make_error_code(std::future_errc::broken_promise); }
+
+        static std::error_code Exception(const char *) { return std::make_error_code(std::errc::state_not_recoverable); }
+
+        static std::error_code Cancelled() { return std::make_error_code(std::errc::operation_canceled); }
+    };
+}// namespace resultpp
+
+#endif//RESULTPP_ERROR_CODE_HXX
@@ -0,0 +1,278 @@
+#ifndef RESULTPP_ERROR_REGISTRY_HXX
+#define RESULTPP_ERROR_REGISTRY_HXX
+
+#include <array>      // std::array
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint16_t, std::uint64_t
+#include <iterator>   // std::size
+#include <string_view>// std::string_view
+#include <type_traits>// std::enable_if_t, std::is_enum_v, std::underlying_type_t
+
+#include "resultpp.hxx"
+
+namespace resultpp {
+    /**
+     * @brief How bad a registered error is, for logging and alerting.
+     */
+    enum class ErrorSeverity : std::uint8_t {
+        Info,
+        Warning,
+        Error,
+        Fatal,
+    };
+
+    /**
+     * @struct ErrorEntry
+     * @brief One registered error code with its message and severity.
+     */
+    template<typename E>
+    struct ErrorEntry {
+        E code;
+        std::string_view message;
+        ErrorSeverity severity = ErrorSeverity::Error;
+    };
+
+    /**
+     * @struct ErrorRegistry
+     * @brief Compile-time table of the codes of the error enum `E`. Specialise it, before `E` is used in a Result,
+     * with a `category` and the `entries`:
+     *
+     * @code
+     * enum class DbError : std::uint16_t { None, Timeout, Conflict, Corrupt = 500 };
+     *
+     * template<> struct resultpp::ErrorRegistry<DbError> {
+     *     static constexpr std::string_view category = "db";
+     *     static constexpr ErrorEntry<DbError> entries[] = {
+     *         {DbError::Timeout, "query timed out", ErrorSeverity::Warning},
+     *         {DbError::Conflict, "write conflict"},
+     *         {DbError::Corrupt, "page checksum mismatch", ErrorSeverity::Fatal},
+     *     };
+     * };
+     * @endcode
+     *
+     * The value-initialised code means success and is not registered. A registered enum gets `ErrorTraits` whose
+     * `Describe` returns the message as a `std::string_view` into the table, so `Result<T, DbError>::Describe()`,
+     * `Unwrap` and result files print it without formatting anything.
+     */
+    template<typename E, typename = void>
+    struct ErrorRegistry;
+
+    namespace internal::registry {
+        template<typename E, typename = void>
+        struct IsRegistered : std::false_type {};
+
+        template<typename E>
+        struct IsRegistered<E, std::void_t<decltype(ErrorRegistry<E>::entries)>> : std::true_type {};
+
+        template<typename E>
+        constexpr std::uint64_t Key(E code) noexcept {
+            if constexpr (std::is_enum_v<E>) return static_cast<std::uint64_t>(static_cast<std::underlying_type_t<E>>(code));
+            else return static_cast<std::uint64_t>(code);
+        }
+
+        /**
+         * @brief Bits of the smallest power of two that is at least `count * ratio`.
+         */
+        constexpr unsigned BitsFor(std::size_t count, std::size_t ratio) noexcept {
+            unsigned bits = 0;
+            while ((std::size_t{1} << bits) < count * ratio) ++bits;
+            return bits;
+        }
+
+        /**
+         * @brief The splitmix64 finaliser: a bijection on 64-bit keys that spreads small, dense codes over all bits.
+         */
+        constexpr std::uint64_t Mix(std::uint64_t key) noexcept {
+            key ^= key >> 30U;
+            key *= 0xBF58476D1CE4E5B9ULL;
+            key ^= key >> 27U;
+            key *= 0x94D049BB133111EBULL;
+            return key ^ (key >> 31U);
+        }
+
+        inline constexpr std::uint16_t kEmpty = 0xFFFF;
+
+        /**
+         * @brief Displacements tried per bucket before giving up; far above what a table at half load ever needs.
+         */
+        inline constexpr std::uint32_t kMaxDisplacement = 0xFFFF;
+
+        template<typename E>
+        inline constexpr std::size_t kCount = std::size(ErrorRegistry<E>::entries);
+
+        /**
+         * @brief Buckets of the first level, about four codes each, and slots of the second, at most half full.
+         */
+        template<typename E>
+        inline constexpr unsigned kBucketBits = BitsFor((kCount<E> + 3) / 4, 1);
+
+        template<typename E>
+        inline constexpr unsigned kSlotBits = BitsFor(kCount<E>, 2) == 0 ? 1 : BitsFor(kCount<E>, 2);
+
+        template<typename E>
+        constexpr std::size_t Bucket(std::uint64_t key) noexcept {
+            if constexpr (kBucketBits<E> == 0) return 0;
+            else return static_cast<std::size_t>(Mix(key) >> (64U - kBucketBits<E>));
+        }
+
+        template<typename E>
+        constexpr std::size_t Slot(std::uint64_t key, std::uint32_t displacement) noexcept {
+            return static_cast<std::size_t>(Mix(key + (displacement + 1ULL) * 0x9E3779B97F4A7C15ULL) >> (64U - kSlotBits<E>));
+        }
+
+        enum class BuildStatus {
+            Ok,
+            SuccessCode,///< The value-initialised code is registered.
+            Duplicate,  ///< A code is registered twice.
+            Exhausted,  ///< A bucket found no displacement; not expected for any real table.
+        };
+
+        template<typename E>
+        struct Table {
+            std::array<std::uint16_t, std::size_t{1} << kBucketBits<E>> displacements{};
+            std::array<std::uint16_t, std::size_t{1} << kSlotBits<E>> slots{};
+            BuildStatus status = BuildStatus::Ok;
+        };
+
+        /**
+         * @brief Hash-and-displace construction (CHD): codes are split into small buckets by one hash, then, largest
+         * bucket first, each bucket gets the first displacement sending all its codes to free slots of the second
+         * level. With the second level at most half full this takes a few tries per bucket, so building is linear in
+         * the number of codes.
+         */
+        template<typename E>
+        constexpr Table<E> Build() noexcept {
+            constexpr std::size_t count = kCount<E>;
+            constexpr std::size_t buckets = std::size_t{1} << kBucketBits<E>;
+            const auto &entries = ErrorRegistry<E>::entries;
+
+            Table<E> table;
+            for (auto &slot : table.slots) slot = kEmpty;
+
+            // Entry indices grouped by bucket, through a counting sort on the bucket.
+            std::array<std::size_t, buckets + 1> start{};
+            std::array<std::uint16_t, count> members{};
+            for (std::size_t i = 0; i < count; ++i) {
+                if (entries[i].code == E{}) {
+                    table.status = BuildStatus::SuccessCode;
+                    return table;
+                }
+                ++start[Bucket<E>(Key(entries[i].code)) + 1];
+            }
+            for (std::size_t b = 0; b < buckets; ++b) start[b + 1] += start[b];
+            std::array<std::size_t, buckets> fill{};
+            for (std::size_t i = 0; i < count; ++i) {
+                auto b = Bucket<E>(Key(entries[i].code));
+                members[start[b] + fill[b]++] = static_cast<std::uint16_t>(i);
+            }
+
+            // Buckets by descending size, through a counting sort on the size.
+            std::array<std::size_t, count + 2> bySize{};
+            std::array<std::size_t, buckets> order{};
+            for (std::size_t b = 0; b < buckets; ++b) ++bySize[count - (start[b + 1] - start[b]) + 1];
+            for (std::size_t size = 0; size <= count; ++size) bySize[size + 1] += bySize[size];
+            for (std::size_t b = 0; b < buckets; ++b) order[bySize[count - (start[b + 1] - start[b])]++] = b;
+
+            std::array<std::size_t, count> placed{};
+            for (auto b : order) {
+                const auto first = start[b], size = start[b + 1] - first;
+                if (size == 0) break;
+                for (std::size_t i = first; i < first + size; ++i) {
+                    for (std::size_t j = first; j < i; ++j) {
+                        if (entries[members[i]].code == entries[members[j]].code) {
+                            table.status = BuildStatus::Duplicate;
+                            return table;
+                        }
+                    }
+                }
+
+                bool done = false;
+                for (std::uint32_t displacement = 0; !done && displacement <= kMaxDisplacement; ++displacement) {
+                    done = true;
+                    for (std::size_t k = 0; done && k < size; ++k) {
+                        placed[k] = Slot<E>(Key(entries[members[first + k]].code), displacement);
+                        done = table.slots[placed[k]] == kEmpty;
+                        for (std::size_t j = 0; done && j < k; ++j) done = placed[j] != placed[k];
+                    }
+                    if (done) {
+                        table.displacements[b] = static_cast<std::uint16_t>(displacement);
+                        for (std::size_t k = 0; k < size; ++k) table.slots[placed[k]] = members[first + k];
+                    }
+                }
+                if (!done) {
+                    table.status = BuildStatus::Exhausted;
+                    return table;
+                }
+            }
+            return table;
+        }
+
+        /**
+         * @struct PerfectHash
+         * @brief Collision-free two-level hash of the codes of `E` into a table of entry indices, built at compile
+         * time.
+         */
+        template<typename E>
+        struct PerfectHash {
+            static_assert(kCount<E> > 0, "an ErrorRegistry needs at least one entry");
+            static_assert(kCount<E> < kEmpty, "an ErrorRegistry holds at most 65534 entries");
+
+            static constexpr Table<E> kTable = Build<E>();
+            static_assert(kTable.status != BuildStatus::SuccessCode, "ErrorRegistry entries must not register the success code");
+            static_assert(kTable.status != BuildStatus::Duplicate, "ErrorRegistry entries must be distinct");
+            static_assert(kTable.status == BuildStatus::Ok, "no perfect hash found for these error codes");
+
+            static constexpr const ErrorEntry<E> *Find(E code) noexcept {
+                const auto &entries = ErrorRegistry<E>::entries;
+                auto key = Key(code);
+                auto index = kTable.slots[Slot<E>(key, kTable.displacements[Bucket<E>(key)])];
+                if (index == kEmpty || !(entries[index].code == code)) return nullptr;
+                return &entries[index];
+            }
+        };
+    }// namespace internal::registry
+
+    /**
+     * @brief The entry of `code`, or null when it is not registered; two hashes and two table loads.
+     */
+    template<typename E>
+    constexpr const ErrorEntry<E> *FindError(E code) noexcept {
+        return internal::registry::PerfectHash<E>::Find(code);
+    }
+
+    /**
+     * @brief The message of `code`, pointing into static storage.
+     */
+    template<typename E>
+    constexpr std::string_view ErrorMessage(E code) noexcept {
+        if (code == E{}) return "ok";
+        const auto *entry = FindError(code);
+        return entry ? entry->message : "unregistered error";
+    }
+
+    /**
+     * @brief The severity of `code`; `ErrorSeverity::Error` when it is not registered.
+     */
+    template<typename E>
+    constexpr ErrorSeverity SeverityOf(E code) noexcept {
+        const auto *entry = FindError(code);
+        return entry ? entry->severity : ErrorSeverity::Error;
+    }
+
+    /**
+     * @brief The category every code of `E` belongs to.
+     */
+    template<typename E>
+    constexpr std::string_view CategoryOf(E) noexcept { return ErrorRegistry<E>::category; }
+
+    namespace internal {
+        template<typename E>
+        struct ErrorTraits<E, std::enable_if_t<registry::IsRegistered<E>::value>> {
+            static constexpr bool IsError(const E &error) noexcept { return !(error == E{}); }
+
+            static constexpr std::string_view Describe(const E &error) noexcept { return ErrorMessage(error); }
+        };
+    }// namespace internal
+}// namespace resultpp
+
+#endif//RESULTPP_ERROR_REGISTRY_HXX
@@ -0,0 +1,228 @@
+#ifndef RESULTPP_ERRORSITES_HXX
+#define RESULTPP_ERRORSITES_HXX
+
+#include <algorithm>// std::find, std::partial_sort, std::remove_if
+#include <atomic>   // std::atomic
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::int32_t, std::uint32_t, std::uint64_t
+#include <cstdio>   // std::FILE, std::fprintf
+#include <memory>   // std::unique_ptr
+#include <mutex>    // std::mutex, std::lock_guard
+#include <string>   // std::string
+#include <utility>  // std::move
+#include <vector>   // std::vector
+
+#include "ResultImpl.hxx"
+
+#if !defined(RESULTPP_MAX_ERROR_SITES)
+#define RESULTPP_MAX_ERROR_SITES 2048
+#endif
+
+namespace resultpp {
+    /**
+     * @struct ErrorSiteCount
+     * @brief Merged error count of one Err-construction site.
+     */
+    struct ErrorSiteCount {
+        const char *file = nullptr;
+        std::uint32_t line = 0;
+        std::int32_t code = 0;
+        std::uint64_t count = 0;
+    };
+
+    namespace internal {
+        /**
+         * @class SiteErr
+         * @brief Error message produced by `RESULTPP_ERR`, converting to an Err of whichever `ResultImpl<T>` is expected.
+         */
+        class SiteErr {
+            std::string _message;
+
+        public:
+            explicit SiteErr(std::string message) : _message(std::move(message)) {}
+
+            template<typename T>
+            operator ResultImpl<T>() && { return ResultImpl<T>(T{}, std::move(_message)); }
+        };
+
+#if defined(RESULTPP_ENABLE_ERROR_SITES)
+        namespace sites {
+            inline constexpr std::uint32_t kMaxSites = RESULTPP_MAX_ERROR_SITES;
+
+            /**
+             * @brief Per-thread counters, indexed by site. Only the owning thread writes to a shard.
+             */
+            struct Shard {
+                std::atomic<std::uint64_t> counts[kMaxSites]{};
+            };
+
+            struct Registry {
+                std::mutex mutex;
+                std::vector<ErrorSiteCount> sites;
+                std::vector<Shard *> shards;
+                std::unique_ptr<std::uint64_t[]> retired{new std::uint64_t[kMaxSites]{}};
+                std::atomic<std::uint64_t> overflow{0};
+            };
+
+            inline Registry &GetRegistry() {
+                // Leaked on purpose: threads may retire their shard after static destruction has begun.
+                static auto *registry = new Registry;
+                return *registry;
+            }
+
+            inline thread_local Shard *shard = nullptr;
+
+            /**
+             * @brief Owns the shard of a thread and folds its counts into the registry when the thread exits.
+             */
+            struct ShardOwner {
+                std::unique_ptr<Shard> owned;
+
+                ~ShardOwner() {
+                    if (!owned) return;
+                    auto &registry = GetRegistry();
+                    std::lock_guard<std::mutex> lock(registry.mutex);
+                    for (std::uint32_t i = 0; i < kMaxSites; ++i) {
+                        registry.retired[i] += owned->counts[i].load(std::memory_order_relaxed);
+                    }
+                    registry.shards.erase(std::find(registry.shards.begin(), registry.shards.end(), owned.get()));
+                    shard = nullptr;
+                }
+            };
+
+            [[gnu::noinline, gnu::cold]] inline Shard *CreateShard() {
+                static thread_local ShardOwner owner;
+                owner.owned = std::make_unique<Shard>();
+
+                auto &registry = GetRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                registry.shards.push_back(owner.owned.get());
+                shard = owner.owned.get();
+                return shard;
+            }
+        }// namespace sites
+
+        /**
+         * @class ErrorSite
+         * @brief Static descriptor of one Err-construction site, registered once on first use.
+         */
+        class ErrorSite {
+            std::uint32_t _index;
+
+        public:
+            ErrorSite(const char *file, std::uint32_t line, std::int32_t code) {
+                auto &registry = sites::GetRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                _index = static_cast<std::uint32_t>(registry.sites.size());
+                registry.sites.push_back({file, line, code, 0});
+            }
+
+            /**
+             * @brief Count one error at this site. Lock-free: a relaxed load and store on a thread-local counter.
+             */
+            void Increment() const noexcept {
+                if (RESULTPP_UNLIKELY(_index >= sites::kMaxSites)) {
+                    sites::GetRegistry().overflow.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+
+                auto *shard = sites::shard;
+                if (RESULTPP_UNLIKELY(shard == nullptr)) shard = sites::CreateShard();
+                auto &counter = shard->counts[_index];
+                counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+        };
+#endif
+    }// namespace internal
+
+    /**
+     * @brief Merge the per-thread shards and return the count of every registered site.
+     *
+     * Empty when the library is built without `RESULTPP_ENABLE_ERROR_SITES`.
+     */
+    inline std::vector<ErrorSiteCount> ErrorSiteSnapshot() {
+#if defined(RESULTPP_ENABLE_ERROR_SITES)
+        namespace sites = internal::sites;
+        auto &registry = sites::GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        std::vector<ErrorSiteCount> snapshot = registry.sites;
+        for (std::size_t i = 0; i < snapshot.size() && i < sites::kMaxSites; ++i) {
+            auto count = registry.retired[i];
+            for (const auto *shard : registry.shards) count += shard->counts[i].load(std::memory_order_relaxed);
+            snapshot[i].count = count;
+        }
+        return snapshot;
+#else
+        return {};
+#endif
+    }
+
+    /**
+     * @brief Number of errors counted at sites registered beyond `RESULTPP_MAX_ERROR_SITES`.
+     */
+    inline std::uint64_t ErrorSiteOverflow() noexcept {
+#if defined(RESULTPP_ENABLE_ERROR_SITES)
+        return internal::sites::GetRegistry().overflow.load(std::memory_order_relaxed);
+#else
+        return 0;
+#endif
+    }
+
+    /**
+     * @brief The `n` sites with the highest counts, most frequent first. Sites that never fired are omitted.
+     */
+    inline std::vector<ErrorSiteCount> TopErrorSites(std::size_t n) {
+        auto snapshot = ErrorSiteSnapshot();
+        snapshot.erase(std::remove_if(snapshot.begin(), snapshot.end(), [](const ErrorSiteCount &s) { return s.count == 0; }),
+                       snapshot.end());
+        auto middle = snapshot.begin() + static_cast<std::ptrdiff_t>(std::min(n, snapshot.size()));
+        std::partial_sort(snapshot.begin(), middle, snapshot.end(),
+                          [](const ErrorSiteCount &a, const ErrorSiteCount &b) { return a.count > b.count; });
+        snapshot.erase(middle, snapshot.end());
+        return snapshot;
+    }
+
+    /**
+     * @brief Print the `n` most frequent error sites.
+     */
+    inline void DumpTopErrorSites(std::FILE *out = stderr, std::size_t n = 20) {
+        for (const auto &site : TopErrorSites(n)) {
+            std::fprintf(out, "%12llu  %s:%u (code %d)\n", static_cast<unsigned long long>(site.count), site.file, site.line,
+                         site.code);
+        }
+    }
+}// namespace resultpp
+
+#if defined(RESULTPP_ENABLE_ERROR_SITES)
+/**
+ * @brief Count one error at the current source location, tagged with `code` (a constant expression).
+ */
+#define RESULTPP_COUNT_ERR(code)                                                               \
+    ([]() -> const ::resultpp::internal::ErrorSite & {                                         \
+        static const ::resultpp::internal::ErrorSite site(__FILE__, __LINE__, (code));         \
+        return site;                                                                           \
+    }()                                                                                        \
+             .Increment())
+#else
+#define RESULTPP_COUNT_ERR(code) ((void) 0)
+#endif
+
+/**
+ * @brief Construct an Err for the enclosing function's `ResultImpl<T>`, counting it against this call site.
+ *
+ * @code
+ * resultpp::Result<int> Parse(const std::string &s) {
+ *     if (s.empty()) return RESULTPP_ERR_CODE(EINVAL, "empty input");
+ *     ...
+ * }
+ * @endcode
+ */
+#define RESULTPP_ERR_CODE(code, message) (RESULTPP_COUNT_ERR(code), ::resultpp::internal::SiteErr(message))
+
+/**
+ * @brief `RESULTPP_ERR_CODE` with code `0`.
+ */
+#define RESULTPP_ERR(message) RESULTPP_ERR_CODE(0, message)
+
+#endif//RESULTPP_ERRORSITES_HXX
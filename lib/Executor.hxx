@@ -0,0 +1,438 @@
+#ifndef RESULTPP_EXECUTOR_HXX
+#define RESULTPP_EXECUTOR_HXX
+
+#include <algorithm>  // std::max
+#include <atomic>     // std::atomic, std::atomic_thread_fence
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::int64_t, std::uint32_t, std::uintptr_t
+#include <cstring>    // std::memcpy
+#include <deque>      // std::deque
+#include <exception>  // std::exception
+#include <memory>     // std::make_unique, std::unique_ptr
+#include <mutex>      // std::lock_guard, std::mutex
+#include <new>        // std::launder
+#include <thread>     // std::thread
+#include <type_traits>// std::decay_t, std::invoke_result_t, std::is_trivially_copyable_v
+#include <utility>    // std::forward, std::move
+#include <vector>     // std::vector
+
+#include "Cancellation.hxx"
+#include "Future.hxx"
+
+#if RESULTPP_HAS_ATOMIC_WAIT
+namespace resultpp {
+    /**
+     * @brief What an `Executor` does with an exception escaping a submitted task.
+     */
+    enum class ExceptionPolicy {
+        Terminate,///< Call `std::terminate`, as for an exception escaping a `std::thread`.
+        ToErr,    ///< Complete the task's future with `AsyncErrors<E>::Exception(what)`.
+    };
+
+    namespace internal::executor {
+        inline constexpr std::size_t kCacheLine = 64;
+
+        /**
+         * @brief Bytes of callable a `Task` holds without allocating.
+         */
+        inline constexpr std::size_t kInlineSize = 3 * sizeof(void *);
+
+        /**
+         * @class Task
+         * @brief A type-erased `void()` callable in four words: a function pointer and inline storage.
+         *
+         * A trivially copyable callable that fits (a few pointers or indices, like the continuations `Then` posts)
+         * is stored inline; any other is moved to the heap and the storage holds the pointer. Either way the task
+         * itself is trivially copyable, so a deque can copy it word by word and a thief can read a slot before it
+         * has won it. A task runs at most once, which also frees a heap-stored callable.
+         */
+        class Task {
+            using invoke_t = void (*)(Task &);
+
+            template<typename F>
+            static constexpr bool kInline =
+                    std::is_trivially_copyable_v<F> && sizeof(F) <= kInlineSize && alignof(F) <= alignof(void *);
+
+            invoke_t _invoke = nullptr;
+            alignas(void *) unsigned char _storage[kInlineSize];
+
+        public:
+            Task() = default;
+
+            template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Task>>>
+            explicit Task(F &&func) {
+                using func_t = std::decay_t<F>;
+                if constexpr (kInline<func_t>) {
+                    ::new (static_cast<void *>(_storage)) func_t(std::forward<F>(func));
+                    _invoke = [](Task &task) { (*std::launder(reinterpret_cast<func_t *>(task._storage)))(); };
+                } else {
+                    auto *boxed = new func_t(std::forward<F>(func));
+                    std::memcpy(_storage, &boxed, sizeof(boxed));
+                    _invoke = [](Task &task) {
+                        func_t *owned;
+                        std::memcpy(&owned, task._storage, sizeof(owned));
+                        std::unique_ptr<func_t>(owned)->operator()();
+                    };
+                }
+            }
+
+            /**
+             * @brief Whether `F` is stored without allocating.
+             */
+            template<typename F>
+            [[nodiscard]] static constexpr bool IsInline() noexcept { return kInline<std::decay_t<F>>; }
+
+            void operator()() { _invoke(*this); }
+        };
+
+        /**
+         * @class TaskDeque
+         * @brief Chase-Lev work-stealing deque of tasks, after Lê et al., "Correct and Efficient Work-Stealing for
+         * Weak Memory Models": the owning worker pushes and pops at the bottom, other workers steal from the top.
+         *
+         * The ring doubles when full. Outgrown rings are kept until the deque is destroyed, since a thief may still
+         * be reading one.
+         */
+        class TaskDeque {
+            static constexpr std::size_t kWords = sizeof(Task) / sizeof(std::uintptr_t);
+            static_assert(sizeof(Task) % sizeof(std::uintptr_t) == 0 && std::is_trivially_copyable_v<Task>);
+
+            struct Ring {
+                std::size_t mask;
+                std::unique_ptr<std::atomic<std::uintptr_t>[]> words;
+
+                explicit Ring(std::size_t capacity)
+                    : mask(capacity - 1), words(new std::atomic<std::uintptr_t>[capacity * kWords]) {}
+
+                [[nodiscard]] std::int64_t Capacity() const noexcept { return static_cast<std::int64_t>(mask + 1); }
+
+                void Store(std::int64_t index, const Task &task) noexcept {
+                    std::uintptr_t raw[kWords];
+                    std::memcpy(raw, &task, sizeof(Task));
+                    auto *slot = &words[(static_cast<std::size_t>(index) & mask) * kWords];
+                    for (std::size_t w = 0; w < kWords; ++w) slot[w].store(raw[w], std::memory_order_relaxed);
+                }
+
+                [[nodiscard]] Task Load(std::int64_t index) const noexcept {
+                    std::uintptr_t raw[kWords];
+                    const auto *slot = &words[(static_cast<std::size_t>(index) & mask) * kWords];
+                    for (std::size_t w = 0; w < kWords; ++w) raw[w] = slot[w].load(std::memory_order_relaxed);
+                    Task task;
+                    std::memcpy(static_cast<void *>(&task), raw, sizeof(Task));
+                    return task;
+                }
+            };
+
+            alignas(kCacheLine) std::atomic<std::int64_t> _top{0};
+            alignas(kCacheLine) std::atomic<std::int64_t> _bottom{0};
+            std::atomic<Ring *> _ring{nullptr};
+            std::vector<std::unique_ptr<Ring>> _rings;
+
+        public:
+            explicit TaskDeque(std::size_t capacity = 256) {
+                _rings.push_back(std::make_unique<Ring>(capacity));
+                _ring.store(_rings.back().get(), std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Push at the bottom; owner only.
+             */
+            void Push(const Task &task) {
+                auto bottom = _bottom.load(std::memory_order_relaxed);
+                auto top = _top.load(std::memory_order_acquire);
+                auto *ring = _ring.load(std::memory_order_relaxed);
+                if (RESULTPP_UNLIKELY(bottom - top >= ring->Capacity())) ring = Grow(ring, top, bottom);
+                ring->Store(bottom, task);
+                _bottom.store(bottom + 1, std::memory_order_release);
+            }
+
+            /**
+             * @brief Pop the newest task from the bottom; owner only.
+             */
+            bool Pop(Task &task) noexcept {
+                auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+                auto *ring = _ring.load(std::memory_order_relaxed);
+                _bottom.store(bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                auto top = _top.load(std::memory_order_relaxed);
+
+                if (top > bottom) {
+                    _bottom.store(bottom + 1, std::memory_order_release);
+                    return false;
+                }
+                task = ring->Load(bottom);
+                if (top < bottom) return true;
+
+                // The last task: race the thieves for it.
+                bool won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                _bottom.store(bottom + 1, std::memory_order_release);
+                return won;
+            }
+
+            /**
+             * @brief Take the oldest task from the top; any thread. Retries while other thieves win the race, and
+             * fails only once the deque is seen empty.
+             */
+            bool Steal(Task &task) noexcept {
+                for (;;) {
+                    auto top = _top.load(std::memory_order_acquire);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    auto bottom = _bottom.load(std::memory_order_acquire);
+                    if (top >= bottom) return false;
+
+                    task = _ring.load(std::memory_order_acquire)->Load(top);
+                    if (_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                        return true;
+                }
+            }
+
+        private:
+            RESULTPP_COLD Ring *Grow(Ring *ring, std::int64_t top, std::int64_t bottom) {
+                auto next = std::make_unique<Ring>(2 * static_cast<std::size_t>(ring->Capacity()));
+                for (auto i = top; i < bottom; ++i) next->Store(i, ring->Load(i));
+                _rings.push_back(std::move(next));
+                _ring.store(_rings.back().get(), std::memory_order_release);
+                return _rings.back().get();
+            }
+        };
+
+        struct alignas(kCacheLine) Worker {
+            TaskDeque deque;
+            std::uint32_t seed;
+
+            explicit Worker(std::uint32_t index) : seed(2654435761U * (index + 1)) {}
+        };
+
+        /**
+         * @brief The executor and worker the calling thread belongs to, if any.
+         */
+        struct Current {
+            const void *executor = nullptr;
+            std::size_t index = 0;
+        };
+
+        inline thread_local Current current;
+
+        template<typename F, typename R = std::decay_t<std::invoke_result_t<F &>>>
+        using submit_result_t = std::conditional_t<IsResult<R>::value, R, ResultImpl<R>>;
+
+        /**
+         * @class SubmitState
+         * @brief Shared state of the future returned by `Executor::Submit`, also holding the callable, so that a
+         * submission costs one allocation. The task posted for it is a single pointer and is stored inline.
+         */
+        template<typename F, typename R = submit_result_t<F>>
+        class SubmitState final : public future::SharedState<typename R::value_type, typename R::error_type> {
+            using base_t = future::SharedState<typename R::value_type, typename R::error_type>;
+
+            F _func;
+
+        public:
+            explicit SubmitState(F func) : _func(std::move(func)) {}
+
+            void Run(ExceptionPolicy policy) noexcept {
+#if defined(__cpp_exceptions)
+                if (policy == ExceptionPolicy::ToErr) {
+                    try {
+                        this->SetResult(_func());
+                    } catch (const std::exception &e) {
+                        Fail(e.what());
+                    } catch (...) {
+                        Fail("resultpp: unknown exception");
+                    }
+                } else
+#endif
+                {
+                    static_cast<void>(policy);
+                    this->SetResult(_func());
+                }
+                this->Release();
+            }
+
+        private:
+            RESULTPP_COLD void Fail(const char *what) noexcept {
+                this->SetResult(MakeErr<typename base_t::result_t>(AsyncErrors<typename R::error_type>::Exception(what)));
+            }
+        };
+    }// namespace internal::executor
+
+    /**
+     * @class Executor
+     * @brief A work-stealing thread pool.
+     *
+     * Each worker owns a Chase-Lev deque. Work posted from a worker goes to the bottom of its own deque and is popped
+     * from there, newest first while it is still in cache; an idle worker steals from the top of the others', oldest
+     * first. Work posted from other threads goes through one shared queue. Idle workers sleep in `std::atomic::wait`,
+     * and posting only pays for a wake-up while some worker sleeps.
+     *
+     * A task does not allocate when its callable is trivially copyable and at most three pointers big. `Submit`
+     * returns a `ResultFuture` whose shared state also holds the callable, so a submission costs one allocation.
+     * The executor has the `Post(callable)` member `ResultFuture::Then` expects.
+     *
+     * The destructor runs the work still queued, then joins the workers. Blocking a worker on a future that only
+     * its own pool completes deadlocks once every worker does it.
+     */
+    class Executor {
+    public:
+        /**
+         * @param workers Number of worker threads; at least one.
+         * @param policy What becomes of an exception escaping a `Submit`ted task. Posted work must not throw.
+         */
+        explicit Executor(unsigned workers = std::thread::hardware_concurrency(),
+                          ExceptionPolicy policy = ExceptionPolicy::Terminate)
+            : _policy(policy) {
+            workers = std::max(1U, workers);
+            for (unsigned i = 0; i < workers; ++i) _workers.push_back(std::make_unique<internal::executor::Worker>(i));
+            for (unsigned i = 0; i < workers; ++i) _threads.emplace_back([this, i] { Work(i); });
+        }
+
+        Executor(const Executor &) = delete;
+        Executor &operator=(const Executor &) = delete;
+
+        ~Executor() {
+            _stopping.store(true, std::memory_order_release);
+            _epoch.fetch_add(1, std::memory_order_release);
+            _epoch.notify_all();
+            for (auto &thread : _threads) thread.join();
+        }
+
+        [[nodiscard]] std::size_t Size() const noexcept { return _workers.size(); }
+
+        /**
+         * @brief Run `work()` on a worker. It must not throw.
+         */
+        template<typename F>
+        void Post(F &&work) {
+            internal::executor::Task task(std::forward<F>(work));
+            const auto &current = internal::executor::current;
+            if (current.executor == this) {
+                _workers[current.index]->deque.Push(task);
+            } else {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _injected.push_back(task);
+                _injectedSize.store(_injected.size(), std::memory_order_relaxed);
+            }
+            Wake();
+        }
+
+        /**
+         * @brief Run `func()` on a worker and return the future of its outcome.
+         *
+         * `func` may return a plain value or a Result, as for `ResultFuture::Then`; a plain value makes a future with
+         * the default error type. With `ExceptionPolicy::ToErr`, an exception escaping `func` becomes
+         * `AsyncErrors<E>::Exception(what)`.
+         */
+        template<typename F>
+        auto Submit(F &&func) {
+            using state_t = internal::executor::SubmitState<std::decay_t<F>>;
+
+            auto *state = new state_t(std::forward<F>(func));
+            state->AddRef();
+            Post([state, policy = _policy] { state->Run(policy); });
+            return internal::future::Access::Adopt(state);
+        }
+
+        /**
+         * @brief As `Submit(func)`, completing with `Cancelled<R>()` without calling `func` when `token` is cancelled
+         * by the time a worker picks the task up. `func` can check the token itself to stop part way.
+         */
+        template<typename F>
+        auto Submit(CancellationToken token, F &&func) {
+            return Submit(Cancellable(std::move(token), std::forward<F>(func)));
+        }
+
+    private:
+        static constexpr int kSpins = 2;
+
+        void Work(std::size_t index) {
+            internal::executor::current = {this, index};
+            internal::executor::Task task;
+            while (Next(index, task)) task();
+        }
+
+        /**
+         * @brief Find the next task, sleeping while there is none.
+         * @return False once the executor is stopping and no work is left.
+         */
+        bool Next(std::size_t index, internal::executor::Task &task) {
+            for (int spin = 0; spin < kSpins; ++spin) {
+                if (Find(index, task)) return true;
+                std::this_thread::yield();
+            }
+            return Park(index, task);
+        }
+
+        bool Find(std::size_t index, internal::executor::Task &task) {
+            if (_workers[index]->deque.Pop(task)) return true;
+            if (_injectedSize.load(std::memory_order_relaxed) != 0 && TakeInjected(task)) return true;
+            return Steal(index, task);
+        }
+
+        bool TakeInjected(internal::executor::Task &task) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_injected.empty()) return false;
+            task = _injected.front();
+            _injected.pop_front();
+            _injectedSize.store(_injected.size(), std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * @brief Steal from the other workers, starting from a pseudo-random one.
+         */
+        bool Steal(std::size_t index, internal::executor::Task &task) {
+            auto &seed = _workers[index]->seed;
+            seed ^= seed << 13U;
+            seed ^= seed >> 17U;
+            seed ^= seed << 5U;
+
+            auto count = _workers.size();
+            for (std::size_t i = 0, start = seed % count; i < count; ++i) {
+                auto victim = (start + i) % count;
+                if (victim != index && _workers[victim]->deque.Steal(task)) return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Sleep until work is posted. The sleeper count and the queues are checked in opposite orders by
+         * `Park` and `Wake`, each behind a full fence, so either the sleeper sees the work or the poster sees the
+         * sleeper.
+         */
+        bool Park(std::size_t index, internal::executor::Task &task) {
+            _sleepers.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            bool found = false;
+            for (;;) {
+                auto epoch = _epoch.load(std::memory_order_acquire);
+                if ((found = Find(index, task)) || _stopping.load(std::memory_order_acquire)) break;
+                _epoch.wait(epoch, std::memory_order_acquire);
+            }
+            _sleepers.fetch_sub(1, std::memory_order_relaxed);
+            return found;
+        }
+
+        void Wake() noexcept {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (RESULTPP_LIKELY(_sleepers.load(std::memory_order_relaxed) == 0)) return;
+            _epoch.fetch_add(1, std::memory_order_release);
+            _epoch.notify_one();
+        }
+
+        ExceptionPolicy _policy;
+        std::vector<std::unique_ptr<internal::executor::Worker>> _workers;
+        std::vector<std::thread> _threads;
+
+        std::mutex _mutex;
+        std::deque<internal::executor::Task> _injected;
+        std::atomic<std::size_t> _injectedSize{0};
+
+        alignas(internal::executor::kCacheLine) std::atomic<std::uint32_t> _epoch{0};
+        std::atomic<std::uint32_t> _sleepers{0};
+        std::atomic<bool> _stopping{false};
+    };
+}// namespace resultpp
+#endif
+
+#endif//RESULTPP_EXECUTOR_HXX
@@ -0,0 +1,363 @@
+#ifndef RESULTPP_FUTURE_HXX
+#define RESULTPP_FUTURE_HXX
+
+#include <atomic>     // std::atomic
+#include <cstdint>    // std::uint32_t
+#include <optional>   // std::optional
+#include <type_traits>// std::conditional_t, std::decay_t, std::enable_if_t, std::invoke_result_t
+#include <utility>    // std::exchange, std::forward, std::move
+
+#include "AsyncErrors.hxx"
+#include "Sync.hxx"
+#include "resultpp.hxx"
+
+#if RESULTPP_HAS_ATOMIC_WAIT
+namespace resultpp {
+    /**
+     * @struct InlineExecutor
+     * @brief Runs posted work right away on the calling thread. Continuations attached without an executor run
+     * this way.
+     */
+    struct InlineExecutor {
+        template<typename F>
+        void Post(F &&work) const { std::forward<F>(work)(); }
+    };
+
+    template<typename T, typename E = std::string>
+    class ResultFuture;
+
+    template<typename T, typename E = std::string>
+    class ResultPromise;
+
+    namespace internal::future {
+        /**
+         * @brief State bit set once a continuation is attached; `kReady` and `kWaiters` come from `sync`.
+         */
+        inline constexpr std::uint32_t kContinuation = 8;
+
+        /**
+         * @brief Payload type of the future returned by `Then(func)`, for `func` called with a `T &&`: the payload
+         * of the returned Result when `func` is fallible, otherwise its return type.
+         */
+        template<typename F, typename T, typename R = std::decay_t<std::invoke_result_t<F, T &&>>>
+        using then_value_t = typename std::conditional_t<IsResult<R>::value, R, ResultImpl<R>>::value_type;
+
+        /**
+         * @brief Lets the types that allocate a shared state themselves, such as `Executor`, wrap it in a future.
+         */
+        struct Access;
+
+        struct Continuation {
+            virtual void Run() noexcept = 0;
+
+        protected:
+            ~Continuation() = default;
+        };
+
+        /**
+         * @class SharedState
+         * @brief The single allocation shared by a promise, its future and at most one continuation.
+         *
+         * `_state` moves from empty to ready exactly once. Whichever of `SetResult` and `Attach` comes second sees
+         * the other's bit and runs the continuation, so it runs exactly once and without a lock.
+         */
+        template<typename T, typename E>
+        class SharedState {
+        public:
+            using result_t = ResultImpl<T, E>;
+
+            SharedState() = default;
+            SharedState(const SharedState &) = delete;
+            SharedState &operator=(const SharedState &) = delete;
+            virtual ~SharedState() = default;
+
+            void AddRef() noexcept { _refs.fetch_add(1, std::memory_order_relaxed); }
+
+            void Release() noexcept {
+                if (_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+            }
+
+            [[nodiscard]] bool IsReady() const noexcept {
+                return _state.load(std::memory_order_acquire) & sync::kReady;
+            }
+
+            /**
+             * @brief Store the outcome, wake the waiters and run the continuation. Called at most once.
+             */
+            template<typename R>
+            void SetResult(R &&result) {
+                _result.emplace(std::forward<R>(result));
+                auto previous = _state.fetch_or(sync::kReady, std::memory_order_acq_rel);
+                if (previous & sync::kWaiters) _state.notify_all();
+                if (previous & kContinuation) _continuation->Run();
+            }
+
+            result_t &Wait() noexcept {
+                if (RESULTPP_UNLIKELY(!IsReady()))
+                    sync::WaitWhile(_state, [](std::uint32_t word) { return !(word & sync::kReady); });
+                return *_result;
+            }
+
+            /**
+             * @brief Run `continuation` once the outcome is set: now if it already is, else on the setting thread.
+             */
+            void Attach(Continuation *continuation) noexcept {
+                _continuation = continuation;
+                if (_state.fetch_or(kContinuation, std::memory_order_acq_rel) & sync::kReady) continuation->Run();
+            }
+
+        private:
+            std::atomic<std::uint32_t> _refs{1};
+            std::atomic<std::uint32_t> _state{sync::kEmpty};
+            Continuation *_continuation = nullptr;
+            std::optional<result_t> _result;
+        };
+
+        /**
+         * @brief Continuation handing the whole outcome, 'Ok' or 'Err', to a callback; see `ResultFuture::OnReady`.
+         */
+        template<typename T, typename E, typename F>
+        class ReadyCallback final : public Continuation {
+            SharedState<T, E> *_parent;
+            F _func;
+
+        public:
+            ReadyCallback(SharedState<T, E> *parent, F func) : _parent(parent), _func(std::move(func)) {}
+
+            void Run() noexcept override {
+                std::move(_func)(std::move(_parent->Wait()));
+                _parent->Release();
+                delete this;
+            }
+        };
+
+        /**
+         * @class ThenState
+         * @brief State of the future returned by `Then`, doubling as the continuation of its parent, so that
+         * attaching a continuation costs one allocation holding both the callable and the new outcome.
+         *
+         * It owns a reference to the parent, taken over from the consumed future, and the parent's continuation slot
+         * owns a reference to it; both are dropped once it has run.
+         */
+        template<typename T, typename E, typename F, typename Executor>
+        class ThenState final : public SharedState<then_value_t<F, T>, E>, public Continuation {
+            using base_t = SharedState<then_value_t<F, T>, E>;
+
+            SharedState<T, E> *_parent;
+            F _func;
+            Executor *_executor;
+
+        public:
+            ThenState(SharedState<T, E> *parent, F func, Executor *executor)
+                : _parent(parent), _func(std::move(func)), _executor(executor) {}
+
+            void Run() noexcept override {
+                if (RESULTPP_UNLIKELY(_parent->Wait().IsErr())) {
+                    Complete();
+                    return;
+                }
+                if constexpr (std::is_same_v<Executor, InlineExecutor>) Complete();
+                else _executor->Post([this] { Complete(); });
+            }
+
+        private:
+            /**
+             * @brief Set the outcome from the parent's, calling the callable only when the parent is 'Ok'.
+             */
+            void Complete() noexcept {
+                auto &parent = _parent->Wait();
+                if (RESULTPP_LIKELY(parent.IsOk())) this->SetResult(std::move(_func)(std::move(parent).Data()));
+                else this->SetResult(PropagateErr<typename base_t::result_t>(std::move(parent).Message()));
+                std::exchange(_parent, nullptr)->Release();
+                this->Release();
+            }
+        };
+    }// namespace internal::future
+
+    /**
+     * @class ResultFuture
+     * @brief The receiving end of a `ResultPromise`: an asynchronous `ResultImpl<T, E>`.
+     *
+     * `Wait` and `Get` block in `std::atomic::wait` until the outcome is set. `Then` attaches a continuation that
+     * receives the payload and returns a new future; it runs on the thread that sets the outcome (or at once when it
+     * is already set), or is posted to an executor. An 'Err' skips every continuation down the chain without calling
+     * them or posting anything.
+     */
+    template<typename T, typename E>
+    class ResultFuture {
+        template<typename, typename>
+        friend class ResultFuture;
+        template<typename, typename>
+        friend class ResultPromise;
+        friend struct internal::future::Access;
+
+        using state_t = internal::future::SharedState<T, E>;
+
+        state_t *_state = nullptr;
+
+        explicit ResultFuture(state_t *state) noexcept : _state(state) {}
+
+    public:
+        using result_t = internal::ResultImpl<T, E>;
+
+        ResultFuture() = default;
+        ResultFuture(ResultFuture &&other) noexcept : _state(std::exchange(other._state, nullptr)) {}
+        ResultFuture &operator=(ResultFuture &&other) noexcept {
+            if (this != &other) {
+                if (_state) _state->Release();
+                _state = std::exchange(other._state, nullptr);
+            }
+            return *this;
+        }
+        ~ResultFuture() {
+            if (_state) _state->Release();
+        }
+
+        /**
+         * @brief A future that is ready from the start.
+         */
+        template<typename R>
+        static ResultFuture Ready(R &&result) {
+            auto *state = new state_t();
+            state->SetResult(std::forward<R>(result));
+            return ResultFuture(state);
+        }
+
+        /**
+         * @brief Whether the future refers to a shared state; false once moved from, consumed by `Get` or `Then`.
+         */
+        [[nodiscard]] bool Valid() const noexcept { return _state != nullptr; }
+
+        [[nodiscard]] bool IsReady() const noexcept { return _state->IsReady(); }
+
+        /**
+         * @brief Block until the outcome is set and return it. The future keeps it.
+         */
+        const result_t &Wait() const noexcept { return _state->Wait(); }
+
+        /**
+         * @brief Block until the outcome is set and move it out, consuming the future.
+         */
+        result_t Get() && {
+            result_t result(std::move(_state->Wait()));
+            std::exchange(_state, nullptr)->Release();
+            return result;
+        }
+
+        /**
+         * @brief Continue with `func(T &&)` once this future is 'Ok', consuming it.
+         *
+         * `func` may return a plain value or a Result, as for `Map` and `FlatMap`; it must not throw (an exception
+         * escaping it terminates the program), so report failures as an 'Err' instead.
+         *
+         * @return The future of `func`'s outcome, or of this future's error.
+         */
+        template<typename F>
+        auto Then(F &&func) && {
+            static InlineExecutor inlineExecutor;
+            return std::move(*this).Then(inlineExecutor, std::forward<F>(func));
+        }
+
+        /**
+         * @brief Call `func(result_t &&)` with the outcome, 'Ok' or 'Err', once it is set, consuming the future.
+         *
+         * `func` runs on the thread that sets the outcome, or right away when it is already set, and must not throw.
+         * This is the building block for combinators that need to see errors, such as `WhenAll`.
+         */
+        template<typename F>
+        void OnReady(F &&func) && {
+            auto *parent = std::exchange(_state, nullptr);
+            parent->Attach(new internal::future::ReadyCallback<T, E, std::decay_t<F>>(parent, std::forward<F>(func)));
+        }
+
+        /**
+         * @brief As `Then(func)`, with `func` posted to `executor` (anything with a `Post(callable)` member), which
+         * must outlive the continuation.
+         */
+        template<typename Executor, typename F>
+        auto Then(Executor &executor, F &&func) && {
+            using then_t = internal::future::ThenState<T, E, std::decay_t<F>, Executor>;
+            using value_t = internal::future::then_value_t<std::decay_t<F>, T>;
+
+            auto *parent = std::exchange(_state, nullptr);
+            auto *next = new then_t(parent, std::forward<F>(func), &executor);
+            next->AddRef();
+            parent->Attach(next);
+            return ResultFuture<value_t, E>(next);
+        }
+    };
+
+    namespace internal::future {
+        struct Access {
+            /**
+             * @brief A future taking over one reference to `state`.
+             */
+            template<typename T, typename E>
+            static ResultFuture<T, E> Adopt(SharedState<T, E> *state) noexcept { return ResultFuture<T, E>(state); }
+        };
+    }// namespace internal::future
+
+    /**
+     * @class ResultPromise
+     * @brief The producing end of a `ResultFuture`, set once with a payload or a Result.
+     *
+     * The promise, its future and any continuations share one reference-counted allocation, made by the promise.
+     * A promise destroyed without being set leaves its future with `AsyncErrors<E>::BrokenPromise()`.
+     */
+    template<typename T, typename E>
+    class ResultPromise {
+        using state_t = internal::future::SharedState<T, E>;
+
+        state_t *_state = new state_t();
+        bool _retrieved = false;
+        bool _satisfied = false;
+
+    public:
+        using result_t = internal::ResultImpl<T, E>;
+
+        ResultPromise() = default;
+        ResultPromise(ResultPromise &&other) noexcept
+            : _state(std::exchange(other._state, nullptr)), _retrieved(other._retrieved), _satisfied(other._satisfied) {}
+        ResultPromise &operator=(ResultPromise &&other) noexcept {
+            if (this != &other) {
+                Abandon();
+                _state = std::exchange(other._state, nullptr);
+                _retrieved = other._retrieved;
+                _satisfied = other._satisfied;
+            }
+            return *this;
+        }
+        ~ResultPromise() { Abandon(); }
+
+        /**
+         * @brief The future of this promise; throws if it was already retrieved.
+         */
+        ResultFuture<T, E> GetFuture() {
+            if (RESULTPP_UNLIKELY(_retrieved)) internal::ThrowError("resultpp: future already retrieved");
+            _retrieved = true;
+            _state->AddRef();
+            return ResultFuture<T, E>(_state);
+        }
+
+        /**
+         * @brief Set the outcome to `result`, a payload or a Result. Continuations attached so far run on this thread
+         * before it returns. Throws if the promise was already set.
+         */
+        template<typename R>
+        void Set(R &&result) {
+            if (RESULTPP_UNLIKELY(_satisfied)) internal::ThrowError("resultpp: promise already satisfied");
+            _satisfied = true;
+            _state->SetResult(std::forward<R>(result));
+        }
+
+    private:
+        void Abandon() noexcept {
+            if (!_state) return;
+            if (!_satisfied) _state->SetResult(internal::MakeErr<result_t>(AsyncErrors<E>::BrokenPromise()));
+            std::exchange(_state, nullptr)->Release();
+        }
+    };
+}// namespace resultpp
+#endif
+
+#endif//RESULTPP_FUTURE_HXX
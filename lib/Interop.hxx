@@ -0,0 +1,156 @@
+#ifndef RESULTPP_INTEROP_HXX
+#define RESULTPP_INTEROP_HXX
+
+#include <optional>   // std::optional, std::nullopt
+#include <type_traits>// std::decay_t, std::enable_if_t, std::is_constructible_v
+#include <utility>    // std::forward, std::move
+#include <variant>    // std::variant, std::get, std::in_place_index
+
+#if __has_include(<version>)
+#include <version>// __cpp_lib_expected
+#endif
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#include <expected>// std::expected, std::unexpected
+#define RESULTPP_HAS_EXPECTED 1
+#else
+#define RESULTPP_HAS_EXPECTED 0
+#endif
+
+#include "resultpp.hxx"
+
+namespace resultpp {
+    namespace internal {
+        /**
+         * @brief `std::variant<U, G>` holding the payload at index 0 and the error at index 1.
+         */
+        template<typename U, typename G, typename T, typename E>
+        struct ResultConverter<std::variant<U, G>, T, E,
+                               std::enable_if_t<std::is_constructible_v<T, U &&> && std::is_constructible_v<E, G &&>>> {
+            static bool IsOk(const std::variant<U, G> &from) noexcept { return from.index() == 0; }
+
+            template<typename V>
+            static T Value(V &&from) {
+                if (from.index() == 0) return T(std::get<0>(std::forward<V>(from)));
+                return T{};
+            }
+
+            template<typename V>
+            static E Error(V &&from) {
+                if (from.index() == 1) return E(std::get<1>(std::forward<V>(from)));
+                return E{};
+            }
+        };
+
+#if RESULTPP_HAS_EXPECTED
+        template<typename U, typename G, typename T, typename E>
+        struct ResultConverter<std::expected<U, G>, T, E,
+                               std::enable_if_t<std::is_constructible_v<T, U &&> && std::is_constructible_v<E, G &&>>> {
+            static bool IsOk(const std::expected<U, G> &from) noexcept { return from.has_value(); }
+
+            template<typename X>
+            static T Value(X &&from) {
+                if (from.has_value()) return T(*std::forward<X>(from));
+                return T{};
+            }
+
+            template<typename X>
+            static E Error(X &&from) {
+                if (!from.has_value()) return E(std::forward<X>(from).error());
+                return E{};
+            }
+        };
+#endif
+    }// namespace internal
+
+    /**
+     * @brief The payload of an 'Ok' Result, or `std::nullopt` for an 'Err' Result.
+     *
+     * The rvalue overload moves the payload out of `result`.
+     */
+    template<typename T, typename E>
+    std::optional<T> ToOptional(const internal::ResultImpl<T, E> &result) {
+        if (result.IsOk()) return std::optional<T>(result.Data());
+        return std::nullopt;
+    }
+
+    template<typename T, typename E>
+    std::optional<T> ToOptional(internal::ResultImpl<T, E> &&result) {
+        if (result.IsOk()) return std::optional<T>(std::move(result).Data());
+        return std::nullopt;
+    }
+
+    /**
+     * @brief An 'Ok' Result holding the value of `optional`, or an 'Err' Result holding `error` if it is empty.
+     *
+     * The rvalue overload moves the value out of `optional`.
+     */
+    template<typename T, typename E = std::string>
+    internal::ResultImpl<T, E> FromOptional(const std::optional<T> &optional, E error) {
+        if (optional.has_value()) return internal::ResultImpl<T, E>(*optional);
+        return internal::ResultImpl<T, E>(T{}, std::move(error));
+    }
+
+    template<typename T, typename E = std::string>
+    internal::ResultImpl<T, E> FromOptional(std::optional<T> &&optional, E error) {
+        if (optional.has_value()) return internal::ResultImpl<T, E>(std::move(*optional));
+        return internal::ResultImpl<T, E>(T{}, std::move(error));
+    }
+
+    /**
+     * @brief The payload (index 0) or the error (index 1) of `result`.
+     *
+     * The rvalue overload moves the payload or the error out of `result`.
+     */
+    template<typename T, typename E>
+    std::variant<T, E> ToVariant(const internal::ResultImpl<T, E> &result) {
+        if (result.IsOk()) return std::variant<T, E>(std::in_place_index<0>, result.Data());
+        return std::variant<T, E>(std::in_place_index<1>, result.Message());
+    }
+
+    template<typename T, typename E>
+    std::variant<T, E> ToVariant(internal::ResultImpl<T, E> &&result) {
+        if (result.IsOk()) return std::variant<T, E>(std::in_place_index<0>, std::move(result).Data());
+        return std::variant<T, E>(std::in_place_index<1>, std::move(result).Message());
+    }
+
+    /**
+     * @brief The Result holding the alternative of `variant`: index 0 is the payload, index 1 the error.
+     *
+     * Equivalent to the converting constructor, with `T` and `E` deduced.
+     */
+    template<typename V, typename D = std::decay_t<V>>
+    internal::ResultImpl<std::variant_alternative_t<0, D>, std::variant_alternative_t<1, D>> FromVariant(V &&variant) {
+        return internal::ResultImpl<std::variant_alternative_t<0, D>, std::variant_alternative_t<1, D>>(std::forward<V>(variant));
+    }
+
+#if RESULTPP_HAS_EXPECTED
+    /**
+     * @brief `result` as a `std::expected`; the rvalue overload moves the payload or the error out of `result`.
+     */
+    template<typename T, typename E>
+    std::expected<T, E> ToExpected(const internal::ResultImpl<T, E> &result) {
+        if (result.IsOk()) return std::expected<T, E>(std::in_place, result.Data());
+        return std::expected<T, E>(std::unexpect, result.Message());
+    }
+
+    template<typename T, typename E>
+    std::expected<T, E> ToExpected(internal::ResultImpl<T, E> &&result) {
+        if (result.IsOk()) return std::expected<T, E>(std::in_place, std::move(result).Data());
+        return std::expected<T, E>(std::unexpect, std::move(result).Message());
+    }
+
+    /**
+     * @brief The Result holding the value or the error of `expected`.
+     *
+     * Equivalent to the converting constructor, with `T` and `E` deduced. An error equal to a value-initialised `E`
+     * (such as an empty message) reads as 'Ok', since that is how `ResultImpl` tells the two apart.
+     */
+    template<typename X, typename D = std::decay_t<X>>
+    internal::ResultImpl<typename D::value_type, typename D::error_type> FromExpected(X &&expected) {
+        return internal::ResultImpl<typename D::value_type, typename D::error_type>(std::forward<X>(expected));
+    }
+#endif
+}// namespace resultpp
+
+#endif//RESULTPP_INTEROP_HXX
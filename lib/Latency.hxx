@@ -0,0 +1,415 @@
+#ifndef RESULTPP_LATENCY_HXX
+#define RESULTPP_LATENCY_HXX
+
+#include <algorithm>// std::find
+#include <atomic>   // std::atomic
+#include <chrono>   // std::chrono::steady_clock
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::int64_t, std::uint32_t, std::uint64_t
+#include <cstdio>   // std::FILE, std::fprintf
+#include <memory>   // std::unique_ptr
+#include <mutex>    // std::mutex, std::lock_guard
+#include <string>   // std::string
+#include <type_traits>// std::is_enum_v, std::is_integral_v
+#include <utility>  // std::forward, std::move
+#include <vector>   // std::vector
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>// __rdtsc
+#endif
+
+#include "ResultImpl.hxx"
+
+namespace resultpp {
+    /**
+     * @brief Read the low-overhead tick counter: the TSC on x86, steady clock nanoseconds elsewhere.
+     */
+    inline std::uint64_t ReadTicks() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    /**
+     * @brief Nanoseconds per tick of `ReadTicks()`, calibrated once against the steady clock.
+     */
+    inline double NanosecondsPerTick() {
+#if defined(__x86_64__) || defined(__i386__)
+        static const double ratio = [] {
+            auto start = std::chrono::steady_clock::now();
+            auto ticks = ReadTicks();
+            while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(10)) {}
+            auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            return ns / static_cast<double>(ReadTicks() - ticks);
+        }();
+        return ratio;
+#else
+        using period = std::chrono::steady_clock::period;
+        return 1e9 * static_cast<double>(period::num) / static_cast<double>(period::den);
+#endif
+    }
+
+    /**
+     * @class Histogram
+     * @brief HDR-style log-linear histogram of tick counts.
+     *
+     * Values below `2^kSubBucketBits` are counted exactly; above that, every power of two is split into
+     * `2^kSubBucketBits` linear sub-buckets, bounding the relative error to about 6%. Values of `2^kMaxBits` ticks
+     * and more land in the last bucket.
+     */
+    class Histogram {
+    public:
+        static constexpr std::uint32_t kSubBucketBits = 4;
+        static constexpr std::uint32_t kSubBuckets = 1U << kSubBucketBits;
+        static constexpr std::uint32_t kMaxBits = 44;
+        static constexpr std::uint32_t kBuckets = (kMaxBits - kSubBucketBits + 1) * kSubBuckets;
+
+        /**
+         * @brief Index of the bucket counting `value`.
+         */
+        static constexpr std::uint32_t BucketOf(std::uint64_t value) noexcept {
+            if (value < kSubBuckets) return static_cast<std::uint32_t>(value);
+            auto msb = static_cast<std::uint32_t>(63 - __builtin_clzll(value));
+            if (msb >= kMaxBits) return kBuckets - 1;
+            auto shift = msb - kSubBucketBits;
+            auto group = shift + 1;
+            return group * kSubBuckets + static_cast<std::uint32_t>((value >> shift) - kSubBuckets);
+        }
+
+        /**
+         * @brief Smallest value counted by `bucket`.
+         */
+        static constexpr std::uint64_t LowerBound(std::uint32_t bucket) noexcept {
+            auto group = bucket >> kSubBucketBits;
+            if (group == 0) return bucket;
+            return static_cast<std::uint64_t>(kSubBuckets + (bucket & (kSubBuckets - 1))) << (group - 1);
+        }
+
+        /**
+         * @brief Width of `bucket`.
+         */
+        static constexpr std::uint64_t Width(std::uint32_t bucket) noexcept {
+            auto group = bucket >> kSubBucketBits;
+            return group <= 1 ? 1 : 1ULL << (group - 1);
+        }
+
+    private:
+        std::uint64_t _counts[kBuckets]{};
+        std::uint64_t _total = 0;
+        std::uint64_t _max = 0;
+
+    public:
+        void Record(std::uint64_t value) noexcept {
+            ++_counts[BucketOf(value)];
+            ++_total;
+            if (value > _max) _max = value;
+        }
+
+        void Add(std::uint32_t bucket, std::uint64_t count) noexcept {
+            _counts[bucket] += count;
+            _total += count;
+            auto upper = LowerBound(bucket) + Width(bucket) - 1;
+            if (count != 0 && upper > _max) _max = upper;
+        }
+
+        void Merge(const Histogram &other) noexcept {
+            for (std::uint32_t i = 0; i < kBuckets; ++i) _counts[i] += other._counts[i];
+            _total += other._total;
+            if (other._max > _max) _max = other._max;
+        }
+
+        [[nodiscard]] std::uint64_t Count() const noexcept { return _total; }
+        [[nodiscard]] std::uint64_t Max() const noexcept { return _max; }
+        [[nodiscard]] std::uint64_t CountAt(std::uint32_t bucket) const noexcept { return _counts[bucket]; }
+
+        /**
+         * @brief Value at `quantile` (in [0, 1]), reported as the midpoint of the bucket that contains it.
+         */
+        [[nodiscard]] std::uint64_t ValueAt(double quantile) const noexcept {
+            if (_total == 0) return 0;
+            auto rank = static_cast<std::uint64_t>(quantile * static_cast<double>(_total - 1)) + 1;
+            std::uint64_t seen = 0;
+            for (std::uint32_t i = 0; i < kBuckets; ++i) {
+                seen += _counts[i];
+                if (seen >= rank) return LowerBound(i) + Width(i) / 2;
+            }
+            return _max;
+        }
+    };
+
+    /**
+     * @struct OutcomeLatency
+     * @brief Merged latency of one outcome (Ok, or Err with a given code) of an instrumented operation.
+     */
+    struct OutcomeLatency {
+        bool ok = true;
+        std::int64_t code = 0;
+        bool otherCodes = false;///< Err outcome aggregating codes beyond the per-recorder code table.
+        Histogram ticks;
+
+        [[nodiscard]] double Nanoseconds(double quantile) const {
+            return static_cast<double>(ticks.ValueAt(quantile)) * NanosecondsPerTick();
+        }
+    };
+
+    /**
+     * @struct LatencySnapshot
+     * @brief Merged latency of one instrumented operation, split by outcome.
+     */
+    struct LatencySnapshot {
+        std::string name;
+        std::vector<OutcomeLatency> outcomes;
+    };
+
+    namespace internal::latency {
+        /// Slot 0 counts Ok; the remaining slots count Err per code, the last one aggregating unseen codes.
+        inline constexpr std::uint32_t kSlots = 8;
+        inline constexpr std::uint32_t kCodeSlots = kSlots - 2;
+        inline constexpr std::int64_t kFreeCode = INT64_MIN;
+
+        struct Shard {
+            std::atomic<std::uint64_t> counts[kSlots][Histogram::kBuckets]{};
+        };
+
+        struct RecorderState {
+            std::string name;
+            std::atomic<std::int64_t> codes[kCodeSlots];
+            std::unique_ptr<Histogram[]> retired{new Histogram[kSlots]};
+
+            explicit RecorderState(std::string n) : name(std::move(n)) {
+                for (auto &code : codes) code.store(kFreeCode, std::memory_order_relaxed);
+            }
+        };
+
+        struct ThreadShards {
+            std::vector<std::unique_ptr<Shard>> byRecorder;
+        };
+
+        struct Registry {
+            std::mutex mutex;
+            std::vector<std::unique_ptr<RecorderState>> recorders;
+            std::vector<ThreadShards *> threads;
+        };
+
+        inline Registry &GetRegistry() {
+            // Leaked on purpose: threads may retire their shards after static destruction has begun.
+            static auto *registry = new Registry;
+            return *registry;
+        }
+
+        inline thread_local ThreadShards *shards = nullptr;
+
+        inline void Fold(RecorderState &recorder, const Shard &shard) {
+            for (std::uint32_t slot = 0; slot < kSlots; ++slot) {
+                for (std::uint32_t b = 0; b < Histogram::kBuckets; ++b) {
+                    auto count = shard.counts[slot][b].load(std::memory_order_relaxed);
+                    if (count != 0) recorder.retired[slot].Add(b, count);
+                }
+            }
+        }
+
+        /**
+         * @brief Owns the shards of a thread and folds them into the recorders when the thread exits.
+         */
+        struct ThreadOwner {
+            ThreadShards owned;
+
+            ~ThreadOwner() {
+                auto &registry = GetRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                for (std::size_t id = 0; id < owned.byRecorder.size(); ++id) {
+                    if (owned.byRecorder[id]) Fold(*registry.recorders[id], *owned.byRecorder[id]);
+                }
+                registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), &owned));
+                shards = nullptr;
+            }
+        };
+
+        [[gnu::noinline, gnu::cold]] inline Shard *CreateShard(std::uint32_t id) {
+            static thread_local ThreadOwner owner;
+            auto &registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            if (shards == nullptr) {
+                registry.threads.push_back(&owner.owned);
+                shards = &owner.owned;
+            }
+            if (shards->byRecorder.size() <= id) shards->byRecorder.resize(id + 1);
+            shards->byRecorder[id] = std::make_unique<Shard>();
+            return shards->byRecorder[id].get();
+        }
+    }// namespace internal::latency
+
+    /**
+     * @class LatencyRecorder
+     * @brief Named latency histograms of one fallible operation, split by Ok and by error code.
+     *
+     * Recording is lock-free: each thread writes to its own shard with relaxed stores, and shards are merged
+     * only by `LatencySnapshots()`. Recorders live for the whole program; declare them `static`, or use
+     * `RESULTPP_TIMED`.
+     */
+    class LatencyRecorder {
+        std::uint32_t _id;
+        internal::latency::RecorderState *_state;
+
+        [[nodiscard]] std::uint32_t SlotOf(std::int64_t code) const noexcept {
+            using namespace internal::latency;
+            for (std::uint32_t i = 0; i < kCodeSlots; ++i) {
+                auto current = _state->codes[i].load(std::memory_order_relaxed);
+                if (current == code) return i + 1;
+                if (current == kFreeCode) {
+                    if (_state->codes[i].compare_exchange_strong(current, code, std::memory_order_relaxed) || current == code) {
+                        return i + 1;
+                    }
+                }
+            }
+            return kSlots - 1;
+        }
+
+    public:
+        explicit LatencyRecorder(std::string name) {
+            auto &registry = internal::latency::GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            _id = static_cast<std::uint32_t>(registry.recorders.size());
+            registry.recorders.push_back(std::make_unique<internal::latency::RecorderState>(std::move(name)));
+            _state = registry.recorders.back().get();
+        }
+
+        LatencyRecorder(const LatencyRecorder &) = delete;
+        LatencyRecorder &operator=(const LatencyRecorder &) = delete;
+
+        /**
+         * @brief Record `ticks` for an Ok outcome, or for an Err outcome with `code`.
+         */
+        void Record(std::uint64_t ticks, bool ok, std::int64_t code = 0) noexcept {
+            using namespace internal::latency;
+            auto *threadShards = shards;
+            Shard *shard = nullptr;
+            if (RESULTPP_LIKELY(threadShards != nullptr && _id < threadShards->byRecorder.size())) {
+                shard = threadShards->byRecorder[_id].get();
+            }
+            if (RESULTPP_UNLIKELY(shard == nullptr)) shard = CreateShard(_id);
+
+            auto &counter = shard->counts[ok ? 0 : SlotOf(code)][Histogram::BucketOf(ticks)];
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * @brief Default error code of a result, used to split Err latencies. Integral and enum errors are their own
+     * code; message-based results have none, so every Err shares code `0`.
+     */
+    template<typename T, typename E>
+    constexpr std::int64_t ErrorCodeOf(const internal::ResultImpl<T, E> &result) noexcept {
+        if constexpr (std::is_integral_v<E> || std::is_enum_v<E>) return static_cast<std::int64_t>(result.Message());
+        else return 0;
+    }
+
+    /**
+     * @brief Call `func()` and record its latency in `recorder` under the outcome of the returned result.
+     *
+     * @param recorder The recorder to update.
+     * @param func A callable returning a `ResultImpl`.
+     * @param codeOf A callable mapping the result to the error code used for Err outcomes.
+     * @return The result of `func()`.
+     */
+    template<typename F, typename C>
+    decltype(auto) Timed(LatencyRecorder &recorder, F &&func, C &&codeOf) {
+        auto start = ReadTicks();
+        auto result = std::forward<F>(func)();
+        auto elapsed = ReadTicks() - start;
+        recorder.Record(elapsed, result.IsOk(), result.IsOk() ? 0 : codeOf(result));
+        return result;
+    }
+
+    template<typename F>
+    decltype(auto) Timed(LatencyRecorder &recorder, F &&func) {
+        return Timed(recorder, std::forward<F>(func), [](const auto &result) { return ErrorCodeOf(result); });
+    }
+
+    /**
+     * @brief Merge every thread's shards into one snapshot per recorder. Outcomes that never occurred are omitted.
+     */
+    inline std::vector<LatencySnapshot> LatencySnapshots() {
+        using namespace internal::latency;
+        auto &registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        std::vector<LatencySnapshot> snapshots;
+        for (std::size_t id = 0; id < registry.recorders.size(); ++id) {
+            const auto &recorder = *registry.recorders[id];
+            LatencySnapshot snapshot{recorder.name, {}};
+
+            for (std::uint32_t slot = 0; slot < kSlots; ++slot) {
+                OutcomeLatency outcome;
+                outcome.ok = slot == 0;
+                outcome.otherCodes = slot == kSlots - 1;
+                if (slot != 0 && slot <= kCodeSlots) outcome.code = recorder.codes[slot - 1].load(std::memory_order_relaxed);
+
+                outcome.ticks.Merge(recorder.retired[slot]);
+                for (const auto *thread : registry.threads) {
+                    if (id >= thread->byRecorder.size() || !thread->byRecorder[id]) continue;
+                    const auto &counts = thread->byRecorder[id]->counts[slot];
+                    for (std::uint32_t b = 0; b < Histogram::kBuckets; ++b) {
+                        auto count = counts[b].load(std::memory_order_relaxed);
+                        if (count != 0) outcome.ticks.Add(b, count);
+                    }
+                }
+                if (outcome.ticks.Count() != 0) snapshot.outcomes.push_back(std::move(outcome));
+            }
+            snapshots.push_back(std::move(snapshot));
+        }
+        return snapshots;
+    }
+
+    /**
+     * @brief Write every recorder's outcomes as CSV: name, outcome, code, count, p50, p99, p999 and max in ns.
+     */
+    inline void ExportLatencyCsv(std::FILE *out) {
+        std::fprintf(out, "name,outcome,code,count,p50_ns,p99_ns,p999_ns,max_ns\n");
+        for (const auto &snapshot : LatencySnapshots()) {
+            for (const auto &o : snapshot.outcomes) {
+                const char *outcome = o.ok ? "ok" : (o.otherCodes ? "err_other" : "err");
+                std::fprintf(out, "\"%s\",%s,%lld,%llu,%.1f,%.1f,%.1f,%.1f\n", snapshot.name.c_str(), outcome,
+                             static_cast<long long>(o.code), static_cast<unsigned long long>(o.ticks.Count()),
+                             o.Nanoseconds(0.5), o.Nanoseconds(0.99), o.Nanoseconds(0.999),
+                             static_cast<double>(o.ticks.Max()) * NanosecondsPerTick());
+            }
+        }
+    }
+
+    /**
+     * @brief Print p50/p99/p999 of every recorder, one line per outcome.
+     */
+    inline void DumpLatency(std::FILE *out = stderr) {
+        for (const auto &snapshot : LatencySnapshots()) {
+            std::fprintf(out, "%s\n", snapshot.name.c_str());
+            for (const auto &o : snapshot.outcomes) {
+                if (o.ok) std::fprintf(out, "  %-16s", "Ok");
+                else if (o.otherCodes) std::fprintf(out, "  %-16s", "Err (other)");
+                else std::fprintf(out, "  Err code %-7lld", static_cast<long long>(o.code));
+                std::fprintf(out, " n=%-10llu p50=%10.1fns p99=%10.1fns p999=%10.1fns\n",
+                             static_cast<unsigned long long>(o.ticks.Count()), o.Nanoseconds(0.5), o.Nanoseconds(0.99),
+                             o.Nanoseconds(0.999));
+            }
+        }
+    }
+}// namespace resultpp
+
+/**
+ * @brief Evaluate the `ResultImpl`-returning expression `expr`, recording its latency under `name`.
+ *
+ * @code
+ * auto row = RESULTPP_TIMED("db.lookup", db.Lookup(key));
+ * @endcode
+ */
+#define RESULTPP_TIMED(name, expr)                                        \
+    ::resultpp::Timed(                                                    \
+            []() -> ::resultpp::LatencyRecorder & {                       \
+                static ::resultpp::LatencyRecorder recorder(name);        \
+                return recorder;                                          \
+            }(),                                                          \
+            [&]() { return expr; })
+
+#endif//RESULTPP_LATENCY_HXX
@@ -0,0 +1,229 @@
+#ifndef RESULTPP_LAZYRESULT_HXX
+#define RESULTPP_LAZYRESULT_HXX
+
+#include <cstddef>    // std::size_t
+#include <tuple>      // std::tuple, std::tuple_cat, std::get
+#include <type_traits>// std::decay_t
+#include <utility>    // std::declval, std::forward, std::move
+
+#include "ResultImpl.hxx"
+
+namespace resultpp::internal {
+    namespace lazy {
+        enum class StageKind {
+            Map,
+            FlatMap,
+            MapErr,
+            Or,
+            OrElse,
+        };
+
+        /**
+         * @brief One recorded combinator. `output_t<V, E>` is the argument type handed to the next stage when this
+         * one receives a `V` on the Ok path.
+         */
+        template<StageKind Kind, typename U, typename F>
+        struct Stage {
+            static constexpr StageKind kind = Kind;
+            F func;
+
+            template<typename V, typename E>
+            using output_t = V;
+        };
+
+        template<typename U, typename F>
+        struct Stage<StageKind::Map, U, F> {
+            static constexpr StageKind kind = StageKind::Map;
+            F func;
+
+            template<typename V, typename E>
+            using output_t = mapped_t<U, F, V>;
+        };
+
+        template<typename U, typename F>
+        struct Stage<StageKind::FlatMap, U, F> {
+            static constexpr StageKind kind = StageKind::FlatMap;
+            F func;
+
+            template<typename V, typename E>
+            using output_t = typename flat_mapped_t<U, E, F, V>::value_type;
+        };
+
+        template<typename U, typename R>
+        struct Stage<StageKind::Or, U, R> {
+            static constexpr StageKind kind = StageKind::Or;
+            R other;
+
+            template<typename V, typename E>
+            using output_t = V;
+        };
+
+        /**
+         * @brief Argument type reaching the end of the chain when the first stage receives a `V`.
+         */
+        template<typename V, typename E, typename... Stages>
+        struct Fold {
+            using type = V;
+        };
+
+        template<typename V, typename E, typename S, typename... Rest>
+        struct Fold<V, E, S, Rest...> {
+            using type = typename Fold<typename S::template output_t<V, E>, E, Rest...>::type;
+        };
+    }// namespace lazy
+
+    /**
+     * @class LazyResult
+     * @brief A chain of combinators recorded at compile time and run in a single pass by `Eval`.
+     *
+     * Created by `ResultImpl::Lazy()`. Every combinator returns a longer chain instead of a Result, so
+     * `r.Lazy().Map(f).AndThen(g).Map(h).Or(x).Eval()` builds no intermediate Result: `Eval` tests the source once,
+     * hands the payload from stage to stage as a plain value, and on an Err jumps straight to the error stages
+     * (`MapErr`, `Or`, `OrElse`) that follow the failing one. Only `FlatMap` stages, whose callable returns a
+     * Result, test again.
+     *
+     * The combinators mean the same as on `ResultImpl`. An error that a stage maps to a value-initialised `E`
+     * continues as 'Ok' with a value-initialised payload.
+     *
+     * Callables are stored in the chain by value. Closures are inlined into `Eval`; plain functions decay to
+     * pointers, which the compiler may leave as calls.
+     *
+     * @tparam Source `const ResultImpl<T, E> &` when started from an lvalue, which must then outlive the chain, or
+     * `ResultImpl<T, E>` when started from an rvalue, which is moved in.
+     * @note A chain is consumed by its combinators and by `Eval`, so they are only callable on rvalues.
+     */
+    template<typename Source, typename... Stages>
+    class LazyResult {
+        template<typename, typename...>
+        friend class LazyResult;
+
+        using source_t = std::decay_t<Source>;
+        using input_t = decltype(std::declval<Source &&>().Data());
+
+    public:
+        using error_type = typename source_t::error_type;
+        using value_type = std::decay_t<typename lazy::Fold<input_t, error_type, Stages...>::type>;
+        using result_t = ResultImpl<value_type, error_type>;
+
+        explicit LazyResult(Source source, std::tuple<Stages...> stages = {})
+            : _source(static_cast<Source &&>(source)), _stages(std::move(stages)) {}
+
+        template<typename U = void, typename F>
+        auto Map(F &&func) && {
+            return std::move(*this).Append(lazy::Stage<lazy::StageKind::Map, U, std::decay_t<F>>{std::forward<F>(func)});
+        }
+
+        template<typename U = void, typename F>
+        auto AndThen(F &&func) && {
+            return std::move(*this).template Map<U>(std::forward<F>(func));
+        }
+
+        template<typename U = void, typename F>
+        auto FlatMap(F &&func) && {
+            return std::move(*this).Append(lazy::Stage<lazy::StageKind::FlatMap, U, std::decay_t<F>>{std::forward<F>(func)});
+        }
+
+        template<typename F>
+        auto MapErr(F &&func) && {
+            return std::move(*this).Append(lazy::Stage<lazy::StageKind::MapErr, void, std::decay_t<F>>{std::forward<F>(func)});
+        }
+
+        /**
+         * @brief On an Err, continue with `other`, as `ResultImpl::Or` does: with its payload when it is 'Ok', on the
+         * error path with its error otherwise.
+         */
+        auto Or(result_t other) && {
+            return std::move(*this).Append(lazy::Stage<lazy::StageKind::Or, void, result_t>{std::move(other)});
+        }
+
+        template<typename F>
+        auto OrElse(F &&func) && {
+            return std::move(*this).Append(lazy::Stage<lazy::StageKind::OrElse, void, std::decay_t<F>>{std::forward<F>(func)});
+        }
+
+        /**
+         * @brief Run the chain and produce its Result.
+         */
+        result_t Eval() && {
+            if (RESULTPP_LIKELY(_source.IsOk())) return RunOk<0>(static_cast<Source &&>(_source).Data());
+            return RunErrCold<0, input_t>(static_cast<Source &&>(_source).Message());
+        }
+
+    private:
+        Source _source;
+        std::tuple<Stages...> _stages;
+
+        template<typename S>
+        LazyResult<Source, Stages..., S> Append(S &&stage) && {
+            return LazyResult<Source, Stages..., S>(static_cast<Source &&>(_source),
+                                                     std::tuple_cat(std::move(_stages), std::tuple<S>(std::move(stage))));
+        }
+
+        template<std::size_t I, typename V>
+        result_t RunOk(V &&value) {
+            if constexpr (I == sizeof...(Stages)) {
+                return result_t(std::forward<V>(value));
+            } else {
+                auto &stage = std::get<I>(_stages);
+                using stage_t = std::decay_t<decltype(stage)>;
+                using output_t = typename stage_t::template output_t<V &&, error_type>;
+
+                if constexpr (stage_t::kind == lazy::StageKind::Map) {
+                    return RunOk<I + 1>(output_t(std::move(stage.func)(std::forward<V>(value))));
+                } else if constexpr (stage_t::kind == lazy::StageKind::FlatMap) {
+                    ResultImpl<output_t, error_type> next(std::move(stage.func)(std::forward<V>(value)));
+                    if (RESULTPP_LIKELY(next.IsOk())) return RunOk<I + 1>(std::move(next).Data());
+                    return RunErrCold<I + 1, output_t &&>(std::move(next).Message());
+                } else {
+                    return RunOk<I + 1>(std::forward<V>(value));
+                }
+            }
+        }
+
+        /**
+         * @brief Run the error stages from `I` on, `V` being the argument type stage `I` would have received.
+         */
+        template<std::size_t I, typename V, typename Error>
+        result_t RunErr(Error &&error) {
+            if constexpr (I == sizeof...(Stages)) {
+                return PropagateErr<result_t>(std::forward<Error>(error));
+            } else {
+                auto &stage = std::get<I>(_stages);
+                using stage_t = std::decay_t<decltype(stage)>;
+
+                if constexpr (stage_t::kind == lazy::StageKind::MapErr) {
+                    return Resume<I + 1, V>(error_type(std::move(stage.func)(std::forward<Error>(error))));
+                } else if constexpr (stage_t::kind == lazy::StageKind::Or) {
+                    if (stage.other.IsOk()) return RunOk<I + 1>(std::move(stage.other).Data());
+                    return RunErr<I + 1, V>(std::move(stage.other).Message());
+                } else if constexpr (stage_t::kind == lazy::StageKind::OrElse) {
+                    ResultImpl<std::decay_t<V>, error_type> next(std::move(stage.func)(std::forward<Error>(error)));
+                    if (next.IsOk()) return RunOk<I + 1>(std::move(next).Data());
+                    return RunErr<I + 1, V>(std::move(next).Message());
+                } else {
+                    return RunErr<I + 1, typename stage_t::template output_t<V, error_type>>(std::forward<Error>(error));
+                }
+            }
+        }
+
+        /**
+         * @brief `RunErr` out of line and in the cold text section. A named member rather than `InvokeCold` with a
+         * capturing lambda: a captured `this` keeps the Ok path's Result in memory.
+         */
+        template<std::size_t I, typename V, typename Error>
+        RESULTPP_COLD result_t RunErrCold(Error &&error) {
+            return RunErr<I, V>(std::forward<Error>(error));
+        }
+
+        /**
+         * @brief Continue from stage `I` after an error stage replaced the error.
+         */
+        template<std::size_t I, typename V, typename Error>
+        result_t Resume(Error &&error) {
+            if (ErrorTraits<error_type>::IsError(error)) return RunErr<I, V>(std::forward<Error>(error));
+            return RunOk<I>(std::decay_t<V>{});
+        }
+    };
+}// namespace resultpp::internal
+
+#endif//RESULTPP_LAZYRESULT_HXX
@@ -0,0 +1,125 @@
+#ifndef RESULTPP_PARALLEL_HXX
+#define RESULTPP_PARALLEL_HXX
+
+#include <algorithm>  // std::max, std::min
+#include <atomic>     // std::atomic
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint32_t
+#include <iterator>   // std::begin, std::size
+#include <memory>     // std::make_shared
+#include <optional>   // std::optional
+#include <type_traits>// std::decay_t
+#include <utility>    // std::move
+#include <vector>     // std::vector
+
+#include "Cancellation.hxx"
+#include "Executor.hxx"
+
+#if RESULTPP_HAS_ATOMIC_WAIT
+namespace resultpp {
+    namespace internal::parallel {
+        /**
+         * @brief Set in the chunk counter once the outcome is decided by an error; the low bits count the chunks
+         * still running.
+         */
+        inline constexpr std::uint32_t kSettled = 1U << 31U;
+
+        /**
+         * @brief Chunks per worker, so that a slow chunk can be balanced by stealing the others.
+         */
+        inline constexpr std::size_t kChunksPerWorker = 4;
+
+        template<typename Iterator, typename F, typename R>
+        struct TransformState {
+            using value_t = typename R::value_type;
+            using error_t = typename R::error_type;
+            using out_t = ResultImpl<std::vector<value_t>, error_t>;
+
+            Iterator first;
+            F func;
+            CancellationSource source;
+            CancellationToken token = source.Token();
+            std::vector<std::optional<value_t>> outputs;
+            std::atomic<std::uint32_t> pending;
+            std::atomic<bool> skipped{false};
+            ResultPromise<std::vector<value_t>, error_t> promise;
+
+            TransformState(Iterator begin, F f, CancellationSource cancel, std::size_t count, std::uint32_t chunks)
+                : first(begin), func(std::move(f)), source(std::move(cancel)), outputs(count), pending(chunks) {}
+
+            /**
+             * @brief Transform `[begin, end)`, stopping at the first error or once cancelled. The last chunk to
+             * finish settles the outcome, unless an error already has.
+             */
+            void RunChunk(std::size_t begin, std::size_t end) noexcept {
+                for (auto i = begin; i < end; ++i) {
+                    if (RESULTPP_UNLIKELY(token.IsCancelled())) {
+                        skipped.store(true, std::memory_order_relaxed);
+                        break;
+                    }
+                    R result(func(first[static_cast<std::ptrdiff_t>(i)]));
+                    if (RESULTPP_UNLIKELY(result.IsErr())) {
+                        Fail(std::move(result));
+                        break;
+                    }
+                    outputs[i].emplace(std::move(result).Data());
+                }
+                if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) Finish();
+            }
+
+        private:
+            RESULTPP_COLD void Fail(R &&result) noexcept {
+                if (pending.fetch_or(kSettled, std::memory_order_acq_rel) & kSettled) return;
+                source.Cancel();
+                promise.Set(PropagateErr<out_t>(std::move(result).Message()));
+            }
+
+            void Finish() noexcept {
+                if (skipped.load(std::memory_order_relaxed)) {
+                    promise.Set(Cancelled<out_t>());
+                    return;
+                }
+                std::vector<value_t> values;
+                values.reserve(outputs.size());
+                for (auto &output : outputs) values.push_back(std::move(*output));
+                promise.Set(std::move(values));
+            }
+        };
+    }// namespace internal::parallel
+
+    /**
+     * @brief Apply `func` to every element of `input` on `executor`, giving a future of the vector of payloads in
+     * input order, or of the first error.
+     *
+     * `func` takes an element and returns a Result or a plain value, and must not throw. The input is split into a
+     * few chunks per worker. The first 'Err' settles the future and cancels `source`; every chunk checks its token
+     * before each element (one relaxed load) and stops, so the remaining work is skipped. Cancelling `source` from
+     * outside does the same and, unless an error came first, completes the future with `Cancelled<R>()`.
+     *
+     * `input` must be random access and outlive the future; it is read in place, not copied.
+     */
+    template<typename Range, typename F>
+    auto ParallelTransform(Executor &executor, const Range &input, F func, CancellationSource source = CancellationSource()) {
+        using iterator_t = decltype(std::begin(input));
+        using result_t = internal::cancel::cancellable_result_t<F, decltype(*std::begin(input))>;
+        using state_t = internal::parallel::TransformState<iterator_t, F, result_t>;
+        using out_t = typename state_t::out_t;
+
+        auto count = static_cast<std::size_t>(std::size(input));
+        if (count == 0) return ResultFuture<std::vector<typename result_t::value_type>, typename result_t::error_type>::Ready(out_t());
+
+        auto chunks = std::min(count, std::max<std::size_t>(1, executor.Size() * internal::parallel::kChunksPerWorker));
+        auto state = std::make_shared<state_t>(std::begin(input), std::move(func), std::move(source), count,
+                                               static_cast<std::uint32_t>(chunks));
+        auto future = state->promise.GetFuture();
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+            auto begin = count * chunk / chunks;
+            auto end = count * (chunk + 1) / chunks;
+            executor.Post([state, begin, end] { state->RunChunk(begin, end); });
+        }
+        return future;
+    }
+}// namespace resultpp
+#endif
+
+#endif//RESULTPP_PARALLEL_HXX
@@ -0,0 +1,471 @@
+#ifndef RESULTPP_RESULTFILE_HXX
+#define RESULTPP_RESULTFILE_HXX
+
+#include <algorithm>    // std::lower_bound
+#include <bitset>       // std::bitset
+#include <cerrno>       // errno
+#include <cstddef>      // std::byte, std::size_t
+#include <cstdint>      // std::uint32_t, std::uint64_t
+#include <cstdio>       // std::FILE, std::fopen, std::fwrite
+#include <cstring>      // std::memcpy, std::strerror
+#include <memory>       // std::unique_ptr
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <type_traits>  // std::is_same_v, std::is_trivially_copyable_v
+#include <unordered_map>// std::unordered_map
+#include <vector>       // std::vector
+
+#include <fcntl.h>   // open
+#include <sys/mman.h>// mmap, munmap
+#include <sys/stat.h>// fstat
+#include <unistd.h>  // close
+
+#include "resultpp.hxx"
+
+namespace resultpp {
+    namespace internal::columnar {
+        inline constexpr char kMagic[8] = {'R', 'E', 'S', 'U', 'L', 'T', 'P', 'P'};
+        inline constexpr std::uint32_t kVersion = 1;
+        inline constexpr std::uint32_t kByteOrder = 0x01020304;
+
+        /**
+         * @brief Every column starts on a multiple of this many bytes, so mapped columns can be read in place.
+         */
+        inline constexpr std::uint64_t kColumnAlignment = 64;
+
+        /**
+         * @struct FileHeader
+         * @brief First bytes of a result file. Offsets are from the start of the file.
+         */
+        struct FileHeader {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t byteOrder;       ///< `kByteOrder` as written by the producing host.
+            std::uint64_t rows;
+            std::uint64_t payloadSize;     ///< `sizeof(T)`.
+            std::uint64_t payloadOffset;   ///< `rows` payloads; value-initialised for Err rows.
+            std::uint64_t bitmapOffset;    ///< `(rows + 63) / 64` words, bit set for Ok rows.
+            std::uint64_t errors;          ///< Number of Err rows.
+            std::uint64_t errorRowsOffset; ///< `errors` row indices, ascending.
+            std::uint64_t errorCodesOffset;///< `errors` 32-bit indices into the dictionary.
+            std::uint64_t dictionarySize;  ///< Number of distinct messages.
+            std::uint64_t dictionaryOffset;///< `dictionarySize + 1` offsets into the message bytes.
+            std::uint64_t messagesOffset;  ///< Concatenated distinct messages.
+            std::uint64_t fileSize;
+        };
+
+        inline constexpr std::uint64_t AlignUp(std::uint64_t offset) noexcept {
+            return (offset + kColumnAlignment - 1) / kColumnAlignment * kColumnAlignment;
+        }
+
+        inline std::string SystemError(const char *what, const std::string &path) {
+            return std::string("resultpp: ") + what + " '" + path + "': " + std::strerror(errno);
+        }
+    }// namespace internal::columnar
+
+    /**
+     * @class ResultFileWriter
+     * @brief Streams a batch of `Result<T>` into a columnar file readable with `ResultFile<T>`.
+     *
+     * The file holds an Ok bitmap, a fixed-width payload column and a dictionary-encoded error column, listing only
+     * the Err rows with an index into the distinct messages. Payloads are streamed to disk as rows are appended;
+     * the bitmap and the error column stay in memory until `Finish`, which costs one bit per row plus the errors.
+     * Integers are in host byte order.
+     *
+     * @tparam T The payload type; must be trivially copyable.
+     */
+    template<typename T>
+    class ResultFileWriter {
+        static_assert(std::is_trivially_copyable_v<T>, "ResultFile payloads are stored as raw fixed-width bytes");
+        static_assert(alignof(T) <= internal::columnar::kColumnAlignment, "payload alignment exceeds the column alignment");
+
+        static constexpr std::size_t kBufferRows = (std::size_t{1} << 20U) / sizeof(T) + 1;
+
+        std::FILE *_file = nullptr;
+        std::string _path;
+        std::uint64_t _rows = 0;
+        std::unique_ptr<T[]> _buffer;
+        std::size_t _buffered = 0;
+        std::uint64_t _word = 0;///< Bitmap bits of the rows since the last multiple of 64.
+        std::vector<std::uint64_t> _bitmap;
+        std::vector<std::uint64_t> _errorRows;
+        std::vector<std::uint32_t> _errorCodes;
+        std::unordered_map<std::string, std::uint32_t> _dictionary;
+        std::vector<const std::string *> _messages;
+        bool _failed = false;
+
+        void Flush() {
+            if (_buffered != 0 && std::fwrite(_buffer.get(), sizeof(T), _buffered, _file) != _buffered) _failed = true;
+            _buffered = 0;
+        }
+
+        template<typename V>
+        void WriteColumn(const std::vector<V> &column) {
+            if (!column.empty() && std::fwrite(column.data(), sizeof(V), column.size(), _file) != column.size()) _failed = true;
+        }
+
+        std::uint64_t Pad() {
+            auto offset = static_cast<std::uint64_t>(std::ftell(_file));
+            static constexpr char zeros[internal::columnar::kColumnAlignment]{};
+            auto padding = internal::columnar::AlignUp(offset) - offset;
+            if (padding != 0 && std::fwrite(zeros, 1, padding, _file) != padding) _failed = true;
+            return offset + padding;
+        }
+
+        void Push(const T &value, bool ok) {
+            if (RESULTPP_UNLIKELY(_file == nullptr)) return;
+            _word |= std::uint64_t{ok} << (_rows % 64);
+            if (++_rows % 64 == 0) {
+                _bitmap.push_back(_word);
+                _word = 0;
+            }
+
+            _buffer[_buffered] = value;
+            if (++_buffered == kBufferRows) Flush();
+        }
+
+    public:
+        ResultFileWriter() = default;
+        ResultFileWriter(const ResultFileWriter &) = delete;
+        ResultFileWriter &operator=(const ResultFileWriter &) = delete;
+
+        /**
+         * @brief Closes the file. A file that was not `Finish`ed is left incomplete and is rejected by `ResultFile`.
+         */
+        ~ResultFileWriter() {
+            if (_file != nullptr) std::fclose(_file);
+        }
+
+        /**
+         * @brief Create or truncate the file at `path`.
+         * @return `true`, or an Err describing why the file could not be created.
+         */
+        Result<bool> Open(const std::string &path) {
+            _file = std::fopen(path.c_str(), "wb");
+            if (_file == nullptr) return {false, internal::columnar::SystemError("cannot create", path)};
+            _path = path;
+            _buffer = std::make_unique<T[]>(kBufferRows);
+
+            internal::columnar::FileHeader header{};
+            if (std::fwrite(&header, sizeof(header), 1, _file) != 1) _failed = true;
+            Pad();
+            return Result<bool>(true);
+        }
+
+        /**
+         * @brief Append an 'Ok' row. Rows appended before a successful `Open` or after `Finish` are dropped.
+         */
+        void Append(const T &value) { Push(value, true); }
+
+        /**
+         * @brief Append an 'Err' row with `message`.
+         */
+        void AppendErr(const std::string &message) {
+            if (RESULTPP_UNLIKELY(_file == nullptr)) return;
+            auto [entry, inserted] = _dictionary.try_emplace(message, static_cast<std::uint32_t>(_messages.size()));
+            if (inserted) _messages.push_back(&entry->first);
+            _errorRows.push_back(_rows);
+            _errorCodes.push_back(entry->second);
+            Push(T{}, false);
+        }
+
+        /**
+         * @brief Append `result` as an 'Ok' or 'Err' row. Errors that are not strings are stored as their description.
+         */
+        template<typename E>
+        void Append(const internal::ResultImpl<T, E> &result) {
+            if (RESULTPP_LIKELY(result.IsOk())) Append(result.Data());
+            else if constexpr (std::is_same_v<E, std::string>) AppendErr(result.Message());
+            else AppendErr(std::string(internal::ErrorTraits<E>::Describe(result.Message())));
+        }
+
+        [[nodiscard]] std::uint64_t Rows() const noexcept { return _rows; }
+
+        /**
+         * @brief Write the bitmap, error and dictionary columns and the header, then close the file.
+         * @return The number of rows written, or an Err if any write failed.
+         */
+        Result<std::uint64_t> Finish() {
+            namespace columnar = internal::columnar;
+            if (_file == nullptr) return {0, std::string("resultpp: result file is not open")};
+            Flush();
+            if (_rows % 64 != 0) _bitmap.push_back(_word);
+
+            columnar::FileHeader header{};
+            std::memcpy(header.magic, columnar::kMagic, sizeof(header.magic));
+            header.version = columnar::kVersion;
+            header.byteOrder = columnar::kByteOrder;
+            header.rows = _rows;
+            header.payloadSize = sizeof(T);
+            header.payloadOffset = columnar::AlignUp(sizeof(header));
+            header.errors = _errorRows.size();
+            header.dictionarySize = _messages.size();
+
+            header.bitmapOffset = Pad();
+            WriteColumn(_bitmap);
+            header.errorRowsOffset = Pad();
+            WriteColumn(_errorRows);
+            header.errorCodesOffset = Pad();
+            WriteColumn(_errorCodes);
+
+            std::vector<std::uint64_t> offsets{0};
+            for (const auto *message : _messages) offsets.push_back(offsets.back() + message->size());
+            header.dictionaryOffset = Pad();
+            WriteColumn(offsets);
+            header.messagesOffset = Pad();
+            for (const auto *message : _messages) {
+                if (std::fwrite(message->data(), 1, message->size(), _file) != message->size()) _failed = true;
+            }
+            header.fileSize = static_cast<std::uint64_t>(std::ftell(_file));
+
+            if (std::fseek(_file, 0, SEEK_SET) != 0 || std::fwrite(&header, sizeof(header), 1, _file) != 1) _failed = true;
+            if (std::fclose(_file) != 0) _failed = true;
+            _file = nullptr;
+
+            if (_failed) return {0, columnar::SystemError("failed writing", _path)};
+            return Result<std::uint64_t>(_rows);
+        }
+    };
+
+    /**
+     * @class ResultFile
+     * @brief Memory-mapped, read-only view of a file written by `ResultFileWriter<T>`.
+     *
+     * Nothing is deserialized: `IsOk` tests a bit of the mapped bitmap, `Data` reads the mapped payload column and
+     * `Message` returns a view into the mapped dictionary. Scanning for failures with `ForEachError` only touches
+     * the error column.
+     */
+    template<typename T>
+    class ResultFile {
+        static_assert(std::is_trivially_copyable_v<T>, "ResultFile payloads are stored as raw fixed-width bytes");
+
+        const std::byte *_base = nullptr;
+        std::size_t _length = 0;
+        std::string _path;
+        internal::columnar::FileHeader _header{};
+        const T *_payloads = nullptr;
+        const std::uint64_t *_bitmap = nullptr;
+        const std::uint64_t *_errorRows = nullptr;
+        const std::uint32_t *_errorCodes = nullptr;
+        const std::uint64_t *_dictionary = nullptr;
+        const char *_messages = nullptr;
+
+        void Close() noexcept {
+            if (_base != nullptr) munmap(const_cast<std::byte *>(_base), _length);
+            _base = nullptr;
+            _length = 0;
+        }
+
+        [[nodiscard]] bool ColumnFits(std::uint64_t offset, std::uint64_t count, std::uint64_t width) const noexcept {
+            return offset % internal::columnar::kColumnAlignment == 0 && offset <= _length &&
+                   (width == 0 || count <= (_length - offset) / width);
+        }
+
+        /**
+         * @brief Whether the mapped columns agree with each other, so that no lookup can leave them: dictionary
+         * offsets ascend and stay within the messages, every error code names a dictionary entry, and the error rows
+         * ascend and are exactly the rows whose bitmap bit is clear.
+         */
+        [[nodiscard]] bool ColumnsConsistent() const noexcept {
+            const auto &h = _header;
+            for (std::uint64_t i = 0; i < h.dictionarySize; ++i) {
+                if (_dictionary[i] > _dictionary[i + 1]) return false;
+            }
+            if (_dictionary[h.dictionarySize] > _length - h.messagesOffset) return false;
+
+            for (std::uint64_t k = 0; k < h.errors; ++k) {
+                if (_errorCodes[k] >= h.dictionarySize) return false;
+                if (_errorRows[k] >= h.rows || (k != 0 && _errorRows[k] <= _errorRows[k - 1])) return false;
+                if (IsOk(_errorRows[k])) return false;
+            }
+
+            std::uint64_t okRows = 0;
+            for (std::uint64_t word = 0; word < (h.rows + 63) / 64; ++word) {
+                auto bits = _bitmap[word];
+                if (word == h.rows / 64) bits &= (std::uint64_t{1} << (h.rows % 64)) - 1;
+                okRows += std::bitset<64>(bits).count();
+            }
+            return okRows == h.rows - h.errors;
+        }
+
+    public:
+        /**
+         * @class Row
+         * @brief One row of the file, read on access.
+         */
+        class Row {
+            const ResultFile *_file;
+            std::uint64_t _index;
+
+        public:
+            Row(const ResultFile *file, std::uint64_t index) noexcept : _file(file), _index(index) {}
+
+            [[nodiscard]] bool IsOk() const noexcept { return _file->IsOk(_index); }
+            [[nodiscard]] bool IsErr() const noexcept { return !_file->IsOk(_index); }
+            [[nodiscard]] const T &Data() const noexcept { return _file->Data(_index); }
+            [[nodiscard]] std::string_view Message() const noexcept { return _file->Message(_index); }
+            [[nodiscard]] std::uint64_t Index() const noexcept { return _index; }
+
+            /**
+             * @brief Copy the row into an owning `Result<T>`.
+             */
+            [[nodiscard]] Result<T> ToResult() const {
+                if (IsOk()) return Result<T>(Data());
+                return Result<T>(T{}, std::string(Message()));
+            }
+        };
+
+        /**
+         * @class Iterator
+         * @brief Forward iterator over the rows of the file.
+         */
+        class Iterator {
+            const ResultFile *_file;
+            std::uint64_t _index;
+
+        public:
+            Iterator(const ResultFile *file, std::uint64_t index) noexcept : _file(file), _index(index) {}
+
+            Row operator*() const noexcept { return Row(_file, _index); }
+
+            Iterator &operator++() noexcept {
+                ++_index;
+                return *this;
+            }
+
+            bool operator==(const Iterator &other) const noexcept { return _index == other._index; }
+            bool operator!=(const Iterator &other) const noexcept { return _index != other._index; }
+        };
+
+        ResultFile() = default;
+        ResultFile(const ResultFile &) = delete;
+        ResultFile &operator=(const ResultFile &) = delete;
+
+        ~ResultFile() { Close(); }
+
+        /**
+         * @brief Map the file at `path` and check its header and column bounds, in constant time.
+         *
+         * The contents of the columns are trusted: call `Validate` before reading a file that may be corrupt.
+         * @return The number of rows, or an Err if the file cannot be mapped, is malformed or was not written for `T`.
+         */
+        Result<std::uint64_t> Open(const std::string &path) {
+            namespace columnar = internal::columnar;
+            Close();
+
+            int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) return {0, columnar::SystemError("cannot open", path)};
+            struct stat status {};
+            if (fstat(fd, &status) != 0) {
+                auto error = columnar::SystemError("cannot stat", path);
+                close(fd);
+                return {0, error};
+            }
+            _length = static_cast<std::size_t>(status.st_size);
+            if (_length < sizeof(columnar::FileHeader)) {
+                close(fd);
+                return {0, "resultpp: '" + path + "' is too small to be a result file"};
+            }
+
+            void *mapped = mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, fd, 0);
+            auto error = mapped == MAP_FAILED ? columnar::SystemError("cannot map", path) : std::string();
+            close(fd);
+            if (!error.empty()) return {0, error};
+            _base = static_cast<const std::byte *>(mapped);
+
+            std::memcpy(&_header, _base, sizeof(_header));
+            const auto &h = _header;
+            bool valid = std::memcmp(h.magic, columnar::kMagic, sizeof(h.magic)) == 0 && h.version == columnar::kVersion &&
+                         h.byteOrder == columnar::kByteOrder && h.fileSize == _length;
+            if (!valid) {
+                Close();
+                return {0, "resultpp: '" + path + "' is not a complete result file for this host"};
+            }
+            if (h.payloadSize != sizeof(T)) {
+                Close();
+                return {0, "resultpp: '" + path + "' holds " + std::to_string(h.payloadSize) + "-byte payloads, expected " +
+                                   std::to_string(sizeof(T))};
+            }
+            if (!ColumnFits(h.payloadOffset, h.rows, sizeof(T)) || !ColumnFits(h.bitmapOffset, (h.rows + 63) / 64, 8) ||
+                !ColumnFits(h.errorRowsOffset, h.errors, 8) || !ColumnFits(h.errorCodesOffset, h.errors, 4) ||
+                !ColumnFits(h.dictionaryOffset, h.dictionarySize + 1, 8) || !ColumnFits(h.messagesOffset, 0, 0)) {
+                Close();
+                return {0, "resultpp: '" + path + "' has a column out of bounds"};
+            }
+
+            _payloads = reinterpret_cast<const T *>(_base + h.payloadOffset);
+            _bitmap = reinterpret_cast<const std::uint64_t *>(_base + h.bitmapOffset);
+            _errorRows = reinterpret_cast<const std::uint64_t *>(_base + h.errorRowsOffset);
+            _errorCodes = reinterpret_cast<const std::uint32_t *>(_base + h.errorCodesOffset);
+            _dictionary = reinterpret_cast<const std::uint64_t *>(_base + h.dictionaryOffset);
+            _messages = reinterpret_cast<const char *>(_base + h.messagesOffset);
+            if (h.errors > h.rows) {
+                Close();
+                return {0, "resultpp: '" + path + "' has more errors than rows"};
+            }
+            _path = path;
+            return Result<std::uint64_t>(h.rows);
+        }
+
+        /**
+         * @brief Check that the columns agree with each other, so that no lookup can read outside the mapping. Reads
+         * the bitmap, error and dictionary columns once.
+         * @return `true`, or an Err if no file is open or its columns are inconsistent.
+         */
+        Result<bool> Validate() const {
+            if (_base == nullptr) return {false, std::string("resultpp: result file is not open")};
+            if (!ColumnsConsistent()) return {false, "resultpp: '" + _path + "' has inconsistent error columns"};
+            return Result<bool>(true);
+        }
+
+        [[nodiscard]] std::uint64_t Size() const noexcept { return _header.rows; }
+
+        /**
+         * @brief Number of 'Err' rows, read from the header.
+         */
+        [[nodiscard]] std::uint64_t ErrorCount() const noexcept { return _header.errors; }
+
+        [[nodiscard]] bool IsOk(std::uint64_t row) const noexcept { return (_bitmap[row / 64] >> (row % 64)) & 1U; }
+
+        [[nodiscard]] const T &Data(std::uint64_t row) const noexcept { return _payloads[row]; }
+
+        /**
+         * @brief The message of an 'Err' row; empty for 'Ok' rows. Binary searches the error column.
+         */
+        [[nodiscard]] std::string_view Message(std::uint64_t row) const noexcept {
+            if (IsOk(row)) return {};
+            auto *end = _errorRows + _header.errors;
+            auto *found = std::lower_bound(_errorRows, end, row);
+            if (found == end || *found != row) return {};
+            return MessageAt(static_cast<std::uint64_t>(found - _errorRows));
+        }
+
+        /**
+         * @brief The message of the `k`th 'Err' row.
+         */
+        [[nodiscard]] std::string_view MessageAt(std::uint64_t k) const noexcept {
+            auto code = _errorCodes[k];
+            return {_messages + _dictionary[code], static_cast<std::size_t>(_dictionary[code + 1] - _dictionary[code])};
+        }
+
+        Row operator[](std::uint64_t row) const noexcept { return Row(this, row); }
+
+        [[nodiscard]] Iterator begin() const noexcept { return Iterator(this, 0); }
+        [[nodiscard]] Iterator end() const noexcept { return Iterator(this, _header.rows); }
+
+        /**
+         * @brief The whole payload column; entries of 'Err' rows are value-initialised.
+         */
+        [[nodiscard]] const T *Payloads() const noexcept { return _payloads; }
+
+        /**
+         * @brief Call `func(row, message)` for every 'Err' row, in row order, without touching the other columns.
+         */
+        template<typename F>
+        void ForEachError(F &&func) const {
+            for (std::uint64_t k = 0; k < _header.errors; ++k) func(_errorRows[k], MessageAt(k));
+        }
+    };
+}// namespace resultpp
+
+#endif//RESULTPP_RESULTFILE_HXX
@@ -1,16 +1,137 @@
 #ifndef RESULTPP_RESULTIMPL_HXX
 #define RESULTPP_RESULTIMPL_HXX
 
-#include <functional>// std::function
 #include <string>    // std::string
-#include <type_traits>
+#include <string_view>// std::string_view
+#include <type_traits>// std::invoke_result_t, std::conditional_t
 #include <stdexcept> // std::runtime_error
+#include <utility>   // std::forward
+
+#if defined(RESULTPP_ENABLE_BACKTRACE)
+#include "Backtrace.hxx"
+#define RESULTPP_ON_ERR(message)                                                     \
+    do {                                                                             \
+        if (!(message).empty()) ::resultpp::internal::backtrace::OnErr(message);     \
+    } while (0)
+#else
+#define RESULTPP_ON_ERR(message) ((void) 0)
+#endif
+
+// Branch hints and cold-path attributes for the error side. Define RESULTPP_NO_COLD_PATHS to turn them off, e.g.
+// to measure their effect.
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(RESULTPP_NO_COLD_PATHS)
+#define RESULTPP_LIKELY(x) __builtin_expect(!!(x), 1)
+#define RESULTPP_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#define RESULTPP_COLD __attribute__((cold, noinline))
+#else
+#define RESULTPP_LIKELY(x) (x)
+#define RESULTPP_UNLIKELY(x) (x)
+#define RESULTPP_COLD
+#endif
 
 namespace resultpp::internal {
+    /**
+     * @brief Payload type produced by a combinator: `U` when given explicitly, otherwise deduced from `F`.
+     */
+    template<typename U, typename F, typename... Args>
+    using mapped_t = std::conditional_t<std::is_void_v<U>, std::decay_t<std::invoke_result_t<F, Args...>>, U>;
+
+    template<typename T, typename E = std::string>
+    class ResultImpl;
+
+    /**
+     * @brief Tag of the `ResultImpl` constructor that carries an existing error on, without reporting it to the
+     * backtrace hook again.
+     */
+    struct PropagateTag {};
+
+    template<typename Source, typename... Stages>
+    class LazyResult;
+
+    /**
+     * @brief Whether `R` is a `ResultImpl`; callables returning one are treated like `FlatMap` arguments.
+     */
+    template<typename R>
+    struct IsResult : std::false_type {};
+
+    template<typename T, typename E>
+    struct IsResult<ResultImpl<T, E>> : std::true_type {};
+
+    /**
+     * @struct ErrorTraits
+     * @brief Describes how an error value of type `E` marks a Result as failed.
+     *
+     * A Result is 'Ok' while its error compares equal to a value-initialised `E`, so `0` means success for error
+     * codes and an empty message for strings. Specialise for error types where another test is cheaper or where
+     * `Unwrap` should throw a more descriptive message.
+     */
+    template<typename E, typename = void>
+    struct ErrorTraits {
+        static constexpr bool IsError(const E &error) noexcept { return !(error == E{}); }
+
+        static std::string Describe(const E &error) {
+            if constexpr (std::is_enum_v<E>) return "error " + std::to_string(static_cast<std::underlying_type_t<E>>(error));
+            else if constexpr (std::is_integral_v<E>) return "error " + std::to_string(error);
+            else return "resultpp: error";
+        }
+    };
+
+    /**
+     * @struct ResultConverter
+     * @brief Extension point converting a foreign result type `From` (such as `std::expected` or `std::variant`) into
+     * `ResultImpl<T, E>`; see Interop.hxx.
+     *
+     * A specialisation provides `IsOk(const From &)`, and `Value(from)` and `Error(from)` taking `from` by forwarding
+     * reference, each moving out only its own part: `Value` returns the payload (or a value-initialised `T` for an
+     * error) and `Error` the error (or a value-initialised `E` for a value).
+     */
+    template<typename From, typename T, typename E, typename = void>
+    struct ResultConverter;
+
+    template<>
+    struct ErrorTraits<std::string> {
+        static bool IsError(const std::string &error) noexcept { return !error.empty(); }
+
+        static const std::string &Describe(const std::string &error) noexcept { return error; }
+    };
+
+    /**
+     * @brief Throw the error of a failed `Unwrap` or `Expect`.
+     *
+     * Kept out of line and cold, so that callers only carry a call instruction instead of the exception setup.
+     */
+    [[noreturn]] RESULTPP_COLD inline void ThrowError(std::string_view message) { throw std::runtime_error(std::string(message)); }
+
+    /**
+     * @brief Build an Err of result type `R` carrying `message`, out of line and in the cold text section.
+     */
+    template<typename R, typename Error>
+    RESULTPP_COLD R MakeErr(Error &&error) { return R(typename R::value_type{}, std::forward<Error>(error)); }
+
+    /**
+     * @brief As `MakeErr`, for an error taken from another Result: the failure was reported where it was first
+     * created, so the combinators passing it on do not count or sample it once per stage.
+     */
+    template<typename R, typename Error>
+    RESULTPP_COLD R PropagateErr(Error &&error) { return R(PropagateTag{}, std::forward<Error>(error)); }
+
+    /**
+     * @brief Invoke `func` out of line and in the cold text section; used for error-side work of the combinators.
+     */
+    template<typename F>
+    RESULTPP_COLD decltype(auto) InvokeCold(F &&func) { return std::forward<F>(func)(); }
+
+    /**
+     * @brief Result type produced by `FlatMap`: `ResultImpl<U, E>` when `U` is given explicitly, otherwise the return type of `F`.
+     */
+    template<typename U, typename E, typename F, typename... Args>
+    using flat_mapped_t = std::conditional_t<std::is_void_v<U>, std::decay_t<std::invoke_result_t<F, Args...>>, ResultImpl<U, E>>;
+
     /**
      * @class ResultImpl
      * @brief Template class for representing an outcome
      * @tparam T The type of data/ value to be encapsulated
+     * @tparam E The type of the error; a message by default. See `ErrorTraits` for what makes a value an error.
      *
      * @details The `ResultImpl` class can be used in different ways:
      *
@@ -22,13 +143,22 @@ namespace resultpp::internal {
      * @note It's important to use this class with care and ensure that it
      * accurately represents the intended result of encapsulated
      */
-    template<typename T>
+    template<typename T, typename E>
     class ResultImpl {
-        using resultimpl_t = ResultImpl<T>;
+        using resultimpl_t = ResultImpl<T, E>;
+        using traits_t = ErrorTraits<E>;
+
+    public:
+        using value_type = T;
+        using error_type = E;
 
     protected:
         T _type;
-        std::string _message;
+        E _message;
+
+        void OnErr() const {
+            if constexpr (std::is_same_v<E, std::string>) RESULTPP_ON_ERR(_message);
+        }
 
     public:
         /**
@@ -37,32 +167,72 @@ namespace resultpp::internal {
         ResultImpl() = default;
 
         /**
-         * @brief Constructor to create an instance with both data and an optional message.
+         * @brief Constructor to create an 'Ok' instance holding `type`.
+         *
+         * The error is value-initialised rather than copied from `""`, so building an 'Ok' Result costs no
+         * more than moving or copying the data.
          *
          * @param type The data or value to be stored.
-         * @param msg An optional error message (default is an empty string).
          */
-        ResultImpl(T &&type, std::string &&msg = "")
-            : _type(std::forward<T>(type)), _message(std::forward<std::string>(msg)) {}
+        ResultImpl(T &&type) : _type(std::forward<T>(type)) {}
 
-        ResultImpl(const T &type, const std::string &msg = "")
-            : _type(type), _message(msg) {}
+        ResultImpl(const T &type) : _type(type) {}
 
         /**
-         * @brief Operator to set the error message.
-         * @param message The error message to set.
+         * @brief Constructor to create an instance with both data and a message.
+         *
+         * @param type The data or value to be stored.
+         * @param msg The error message; an empty message (a value-initialised `E`) yields an 'Ok' instance.
          */
-        void operator=(const std::string &message) { this->_message = message; }
+        ResultImpl(T &&type, E &&msg)
+            : _type(std::forward<T>(type)), _message(std::forward<E>(msg)) { OnErr(); }
+
+        ResultImpl(T &&type, const E &msg)
+            : _type(std::forward<T>(type)), _message(msg) { OnErr(); }
+
+        ResultImpl(const T &type, const E &msg)
+            : _type(type), _message(msg) { OnErr(); }
 
         /**
-         * @brief Operator to override the current values with those of another ResultImpl instance.
-         * @param ri The ResultImpl instance from which to copy the values.
+         * @brief An 'Err' instance carrying `msg` on from another Result; see `PropagateErr`.
          */
-        void operator=(const resultimpl_t &ri) {
-            if (this == &ri) return;
+        template<typename Error>
+        ResultImpl(PropagateTag, Error &&msg) : _type(), _message(std::forward<Error>(msg)) {}
 
-            this->_type = std::move(ri._type);
-            this->_message = ri._message;
+        /**
+         * @brief Converting constructor from a foreign result type with a `ResultConverter`, e.g. `std::expected<T, E>`.
+         *
+         * An rvalue source is moved from, so the payload and the error are transferred without copies.
+         */
+        template<typename From, typename Converter = ResultConverter<std::decay_t<From>, T, E>,
+                 typename = std::enable_if_t<!std::is_same_v<std::decay_t<From>, T>,
+                                             decltype(Converter::IsOk(std::declval<const std::decay_t<From> &>()))>>
+        ResultImpl(From &&from)
+            : _type(Converter::Value(std::forward<From>(from))), _message(Converter::Error(std::forward<From>(from))) {
+            OnErr();
+        }
+
+        /**
+         * @brief Copy and move operations follow those of `T` and `E`, so move-only payloads such as
+         * `std::unique_ptr` are supported.
+         */
+        ResultImpl(const resultimpl_t &) = default;
+        ResultImpl(resultimpl_t &&) = default;
+        resultimpl_t &operator=(const resultimpl_t &) = default;
+        resultimpl_t &operator=(resultimpl_t &&) = default;
+
+        /**
+         * @brief Operator to set the error message.
+         * @param message The error message to set.
+         */
+        void operator=(const E &message) {
+            this->_message = message;
+            OnErr();
+        }
+
+        void operator=(E &&message) {
+            this->_message = std::move(message);
+            OnErr();
         }
 
         /**
@@ -88,8 +258,8 @@ namespace resultpp::internal {
         /**
          * @brief Swap the content of two ResultImpl instances.
          *
-         * @param r1 The first ResultImpl<T> instance.
-         * @param r2 The second ResultImpl<T> instance.
+         * @param r1 The first ResultImpl<T, E> instance.
+         * @param r2 The second ResultImpl<T, E> instance.
          */
         friend void swap(resultimpl_t &r1, resultimpl_t &r2) {
             std::swap(r1._type, r2._type);
@@ -107,17 +277,38 @@ namespace resultpp::internal {
             return *this;
         }
 
+        resultimpl_t &operator<<(T &&data) {
+            this->_type = std::move(data);
+            return *this;
+        }
+
         /**
          * @brief Get the stored data.
          * @return The stored data or value.
          */
-        [[nodiscard]] const T &Data() const noexcept { return _type; }
+        [[nodiscard]] const T &Data() const & noexcept { return _type; }
+
+        /**
+         * @brief Move the stored data out of an expiring Result.
+         */
+        [[nodiscard]] T &&Data() && noexcept { return std::move(_type); }
 
         /**
          * @brief Get the associated error message.
          * @return The associated error message.
          */
-        [[nodiscard]] const std::string &Message() const noexcept { return _message; }
+        [[nodiscard]] const E &Message() const & noexcept { return _message; }
+
+        /**
+         * @brief Move the associated error message out of an expiring Result.
+         */
+        [[nodiscard]] E &&Message() && noexcept { return std::move(_message); }
+
+        /**
+         * @brief The error as text, from `ErrorTraits<E>::Describe`: the message itself for strings, a view into
+         * static storage for codes registered in an `ErrorRegistry`, and "error N" for other codes.
+         */
+        [[nodiscard]] decltype(auto) Describe() const { return traits_t::Describe(_message); }
 
         /**
          * @brief Set the data using rvalue reference.
@@ -135,13 +326,13 @@ namespace resultpp::internal {
          * @brief Check if the instance represents a successful result (Ok).
          * @return `true` if the instance is in a success state (message is empty), `false` otherwise.
          */
-        [[nodiscard]] constexpr bool IsOk() const noexcept { return _message.empty(); }
+        [[nodiscard]] constexpr bool IsOk() const noexcept { return !traits_t::IsError(_message); }
 
         /**
          * @brief Check if the instance represents an error result (Err).
          * @return `true` if the instance is in an error state (message is not empty), `false` otherwise.
          */
-        [[nodiscard]] constexpr bool IsErr() const noexcept { return !_message.empty(); }
+        [[nodiscard]] constexpr bool IsErr() const noexcept { return traits_t::IsError(_message); }
 
         /**
          * @brief Maps the data value of the Result to a new value using a provided mapping function.
@@ -150,31 +341,63 @@ namespace resultpp::internal {
          * Result with the mapped data. If the Result is in an 'Err' state, the function is not applied, and a new 'Err'
          * Result is returned with the original error message.
          *
-         * @param func A function that takes the current data value and returns a new value of type U.
+         * @tparam U The type of the mapped data; deduced from `func` when omitted.
+         * @param func A callable that takes the current data value and returns a new value of type U.
          * @return A new Result with the mapped data if 'Ok', or a new Result with the original error message if 'Err'.
          */
-        template<typename U>
-        ResultImpl<U> Map(std::function<U(const T &)> func) const {
-            if (IsOk()) return ResultImpl<U>(func(Data()));
-            return ResultImpl<U>(Message());
+        template<typename U = void, typename F>
+        ResultImpl<mapped_t<U, F, const T &>, E> Map(F &&func) const & {
+            using result_t = ResultImpl<mapped_t<U, F, const T &>, E>;
+            if (RESULTPP_LIKELY(IsOk())) return result_t(std::forward<F>(func)(Data()));
+            return PropagateErr<result_t>(Message());
         }
 
         /**
-         * @brief Applies a function to the data value of the Result and returns a new Result with the mapped data.
+         * @brief Consuming `Map`: `func` receives the data as an rvalue and an error message is moved, not copied.
          *
-         * If the Result is in an "Ok" state, the provided function is applied to the data, resulting in a new "Ok"
-         * Result with the mapped data. If the Result is in an "Err" state, the function is not applied, and a new "Err"
-         * Result is returned with the original error message.
+         * When the mapped type is `T`, the data is replaced in place and the Result's storage is moved through, so a
+         * chain of same-type stages on an expiring `Result<std::string>` or `Result<std::vector<X>>` copies neither
+         * the payload nor the message, and an Err passes through without building a new Result.
+         */
+        template<typename U = void, typename F>
+        ResultImpl<mapped_t<U, F, T &&>, E> Map(F &&func) && {
+            using result_t = ResultImpl<mapped_t<U, F, T &&>, E>;
+            if constexpr (std::is_same_v<result_t, resultimpl_t>) {
+                if (RESULTPP_LIKELY(IsOk())) _type = std::forward<F>(func)(std::move(_type));
+                return std::move(*this);
+            } else {
+                if (RESULTPP_LIKELY(IsOk())) return result_t(std::forward<F>(func)(std::move(_type)));
+                return PropagateErr<result_t>(std::move(_message));
+            }
+        }
+
+        /**
+         * @brief Applies a function to the data value of the Result and returns the Result it produces.
+         *
+         * If the Result is in an "Ok" state, the provided function is applied to the data and its Result is returned.
+         * If the Result is in an "Err" state, the function is not applied, and a new "Err" Result is returned with the
+         * original error message.
          *
-         * @tparam U The type of the data to be mapped to.
-         * @param func A function that takes the current data value and returns a new value of type U.
-         * @return A new Result with the mapped data if the Result is in an "Ok" state,
+         * @tparam U The type of the data to be mapped to; deduced from `func` when omitted.
+         * @param func A callable that takes the current data value and returns a `ResultImpl<U, E>`.
+         * @return The Result returned by `func` if the Result is in an "Ok" state,
          *         or a new Result with the original error message if the Result is in an "Err" state.
          */
-        template<typename U>
-        ResultImpl<U> FlatMap(std::function<ResultImpl<U>(const T&)> func) const {
-            if (IsOk()) return func(Data());
-            return ResultImpl<U>(Message());
+        template<typename U = void, typename F>
+        flat_mapped_t<U, E, F, const T &> FlatMap(F &&func) const & {
+            using result_t = flat_mapped_t<U, E, F, const T &>;
+            if (RESULTPP_LIKELY(IsOk())) return std::forward<F>(func)(Data());
+            return PropagateErr<result_t>(Message());
+        }
+
+        /**
+         * @brief Consuming `FlatMap`: `func` receives the data as an rvalue and an error message is moved, not copied.
+         */
+        template<typename U = void, typename F>
+        flat_mapped_t<U, E, F, T &&> FlatMap(F &&func) && {
+            using result_t = flat_mapped_t<U, E, F, T &&>;
+            if (RESULTPP_LIKELY(IsOk())) return std::forward<F>(func)(std::move(_type));
+            return PropagateErr<result_t>(std::move(_message));
         }
 
         /**
@@ -183,48 +406,89 @@ namespace resultpp::internal {
          * resulting in a new ResultImpl instance with the mapped data. If the ResultImpl instance is in an 'Err' state,
          * the mapping function is not applied, and a new ResultImpl instance is returned with the original error message.
          *
-         * @tparam U The type of data to be returned after applying the mapping function.
+         * @tparam U The type of data to be returned after applying the mapping function; deduced when omitted.
          * @param func The mapping function to be applied to the encapsulated data.
          * @return A new ResultImpl<U> instance with the mapped data if the original ResultImpl instance is in an 'Ok' state,
          * or a new ResultImpl<U> instance with the original error message if the original ResultImpl instance is in an 'Err' state.
          */
-        template<typename U>
-        ResultImpl<U> AndThen(std::function<U(const T&)> func) const {
-            if (IsOk()) return ResultImpl<U>(func(Data()));
-            return ResultImpl<U>(Message());
+        template<typename U = void, typename F>
+        ResultImpl<mapped_t<U, F, const T &>, E> AndThen(F &&func) const & {
+            return Map<U>(std::forward<F>(func));
         }
 
         /**
-         * @brief Maps the error value of the Result to a new value using a provided function.
-         * If the Result is in an 'Ok' state, the function is not applied, and a new 'Ok' Result is returned
-         * with the original data. If the Result is in an 'Err' state, the provided function is applied to
-         * the error message to produce a new 'Err' Result with the mapped error value.
+         * @brief Consuming `AndThen`; see the consuming `Map`.
+         */
+        template<typename U = void, typename F>
+        ResultImpl<mapped_t<U, F, T &&>, E> AndThen(F &&func) && {
+            return std::move(*this).template Map<U>(std::forward<F>(func));
+        }
+
+        /**
+         * @brief Maps the error message of the Result using a provided function.
+         * If the Result is in an 'Ok' state, the function is not applied and a copy of the Result is returned.
+         * If the Result is in an 'Err' state, the provided function is applied to the error message to produce
+         * the message of the returned 'Err' Result.
          *
-         * @param func A function that takes the current error message and returns a new error value of type U.
-         * @return A new Result with the original data if 'Ok', or a new Result with the mapped error if 'Err'.
+         * @param func A callable that takes the current error message and returns a new message.
+         * @return A copy of the Result if 'Ok', or a Result with the same data and the mapped message if 'Err'.
+         * @note Mapping to an empty message yields an 'Ok' Result.
+         */
+        template<typename F>
+        resultimpl_t MapErr(F &&func) const & {
+            if (RESULTPP_LIKELY(IsOk())) return *this;
+            return InvokeCold([&] { return resultimpl_t(Data(), std::forward<F>(func)(Message())); });
+        }
+
+        /**
+         * @brief Consuming `MapErr`: `func` receives the message as an rvalue, its result replaces the message in
+         * place, and the Result is moved through.
          */
-        template<typename U>
-        ResultImpl<U> MapErr(std::function<U(const T &)> func) const {
-            if (IsOk()) return ResultImpl<U>(func(Message()));
-            return ResultImpl<U>(Data());
+        template<typename F>
+        resultimpl_t MapErr(F &&func) && {
+            if (RESULTPP_UNLIKELY(IsErr())) InvokeCold([&] { _message = std::forward<F>(func)(std::move(_message)); });
+            return std::move(*this);
         }
 
         /**
          * @brief Combines the current Result with another Result.
          *
          * If the current Result is in an 'Ok' state, it returns a new Result with the data of the current Result.
-         * If the current Result is in an 'Err' state, it returns a new Result with the error message of the other Result.
-         * If both Results are in an 'Err' state, it returns a new Result with the error message of the current Result.
+         * If the current Result is in an 'Err' state, it returns `other`, whether that holds a fallback payload or
+         * an error of its own.
          *
          * @tparam U The type to be encapsulated by the new Result. By default, it's the same as the current Result type.
          * @param other The other Result to combine with the current Result.
          * @return A new Result with the encapsulated data or error message.
          */
         template<typename U = T>
-        resultimpl_t Or(const resultimpl_t &other) const {
-            if (IsOk()) return resultimpl_t(Data());
-            if (IsErr()) return resultimpl_t(other.Message());
-            return resultimpl_t(Message());
+        resultimpl_t Or(const resultimpl_t &other) const & {
+            if (RESULTPP_LIKELY(IsOk())) return resultimpl_t(Data());
+            return other;
+        }
+
+        /**
+         * @brief `Or` with a temporary fallback, moved out instead of copied when it is returned.
+         */
+        template<typename U = T>
+        resultimpl_t Or(resultimpl_t &&other) const & {
+            if (RESULTPP_LIKELY(IsOk())) return resultimpl_t(Data());
+            return std::move(other);
+        }
+
+        /**
+         * @brief Consuming `Or`: an 'Ok' Result is moved through instead of copied.
+         */
+        template<typename U = T>
+        resultimpl_t Or(const resultimpl_t &other) && {
+            if (RESULTPP_LIKELY(IsOk())) return std::move(*this);
+            return other;
+        }
+
+        template<typename U = T>
+        resultimpl_t Or(resultimpl_t &&other) && {
+            if (RESULTPP_LIKELY(IsOk())) return std::move(*this);
+            return std::move(other);
         }
 
         /**
@@ -234,14 +498,22 @@ namespace resultpp::internal {
          * If the current Result is in an 'Err' state, it applies the provided function to the error message
          * to generate a new Result.
          *
-         * @tparam U The type to be encapsulated by the new Result. By default, it's the same as the current Result type.
-         * @param func A function that takes the current error message and returns a new Result.
+         * @param func A callable that takes the current error message and returns a new Result.
          * @return A new Result with the encapsulated data or error message.
          */
-        template<typename U = T>
-        resultimpl_t OrElse(std::function<resultimpl_t(const std::string &)> func) {
-            if (IsOk()) return resultimpl_t(Data());
-            return func(Message());
+        template<typename F>
+        resultimpl_t OrElse(F &&func) const & {
+            if (RESULTPP_LIKELY(IsOk())) return resultimpl_t(Data());
+            return InvokeCold([&] { return resultimpl_t(std::forward<F>(func)(Message())); });
+        }
+
+        /**
+         * @brief Consuming `OrElse`: an 'Ok' Result is moved through, and `func` receives the message as an rvalue.
+         */
+        template<typename F>
+        resultimpl_t OrElse(F &&func) && {
+            if (RESULTPP_LIKELY(IsOk())) return std::move(*this);
+            return InvokeCold([&] { return resultimpl_t(std::forward<F>(func)(std::move(_message))); });
         }
 
         /**
@@ -250,11 +522,28 @@ namespace resultpp::internal {
          * @return The stored data.
          * @throw std::runtime_error If the result is in "Err" state.
          */
-        T Unwrap() const {
-            if (IsOk()) return Data();
-            throw std::runtime_error(Message());
+        T Unwrap() const & {
+            if (RESULTPP_LIKELY(IsOk())) return Data();
+            ThrowError(traits_t::Describe(Message()));
+        }
+
+        /**
+         * @brief Move the stored data out if the result is in "Ok" state, otherwise throw an error.
+         */
+        T Unwrap() && {
+            if (RESULTPP_LIKELY(IsOk())) return std::move(_type);
+            ThrowError(traits_t::Describe(_message));
         }
 
+        /**
+         * @brief Start a lazy chain of combinators over this Result, run in one pass by `Eval()`; see `LazyResult`.
+         *
+         * The lvalue overload refers to this Result, which must outlive the chain; the rvalue overload moves it in.
+         */
+        LazyResult<const resultimpl_t &> Lazy() const & { return LazyResult<const resultimpl_t &>(*this); }
+
+        LazyResult<resultimpl_t> Lazy() && { return LazyResult<resultimpl_t>(std::move(*this)); }
+
         /**
          * @brief Throws an exception with the given error message if the result is in an error state.
          *
@@ -263,11 +552,25 @@ namespace resultpp::internal {
          * @return The encapsulated data if the result is in a success state.
          * @throws std::runtime_error if the result is in an error state.
          */
-        T Expect(const std::string& errorMessage) const {
-            if (IsOk()) return Data();
-            throw std::runtime_error(errorMessage);
+        T Expect(const std::string& errorMessage) const & {
+            if (RESULTPP_LIKELY(IsOk())) return Data();
+            ThrowError(errorMessage);
+        }
+
+        T Expect(const std::string& errorMessage) && {
+            if (RESULTPP_LIKELY(IsOk())) return std::move(_type);
+            ThrowError(errorMessage);
         }
     };
 }// namespace resultpp::internal
 
+#include "LazyResult.hxx"
+
+// Payloads instantiated once by the `resultpp_instances` library are not instantiated again in every translation unit.
+#if defined(RESULTPP_EXTERN_INSTANCES)
+#define RESULTPP_INSTANCE(T) extern template class resultpp::internal::ResultImpl<T>;
+#include "ResultInstances.inc"
+#undef RESULTPP_INSTANCE
+#endif
+
 #endif//RESULTPP_RESULTIMPL_HXX
\ No newline at end of file
@@ -0,0 +1,7 @@
+// Explicit instantiations of ResultImpl for the payloads listed in resultpp_INSTANCE_TYPES.
+// Consumers linking resultpp_instances see them as `extern template` (see ResultImpl.hxx).
+#include "resultpp.hxx"
+
+#define RESULTPP_INSTANCE(T) template class resultpp::internal::ResultImpl<T>;
+#include "ResultInstances.inc"
+#undef RESULTPP_INSTANCE
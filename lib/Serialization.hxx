@@ -0,0 +1,292 @@
+#ifndef RESULTPP_SERIALIZATION_HXX
+#define RESULTPP_SERIALIZATION_HXX
+
+#include <cstddef>     // std::byte, std::size_t
+#include <cstdint>     // std::uint8_t, std::uint32_t
+#include <cstring>     // std::memcpy
+#include <limits>      // std::numeric_limits
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <system_error>// std::error_code, std::error_condition
+#include <type_traits> // std::is_member_pointer_v, std::is_pointer_v, std::is_trivially_copyable_v, std::void_t
+#include <utility>     // std::declval
+#include <vector>      // std::vector
+
+#include "ResultImpl.hxx"
+
+namespace resultpp {
+    /**
+     * @struct Serializer
+     * @brief Encoding of a payload or error type that is not trivially copyable.
+     *
+     * Specialise for your type with:
+     *
+     * @code
+     * template<> struct resultpp::Serializer<Point> {
+     *     static std::size_t Size(const Point &value);                   // exact number of encoded bytes
+     *     static void Write(const Point &value, std::byte *out);         // writes exactly Size(value) bytes
+     *     static Point Read(const std::byte *data, std::size_t size);
+     * };
+     * @endcode
+     *
+     * Fields encoded through a serializer are prefixed with their length; trivially copyable fields without a
+     * serializer are stored as their raw bytes.
+     */
+    template<typename T, typename = void>
+    struct Serializer;
+
+    template<>
+    struct Serializer<std::string> {
+        static std::size_t Size(const std::string &value) noexcept { return value.size(); }
+
+        static void Write(const std::string &value, std::byte *out) noexcept {
+            std::memcpy(out, value.data(), value.size());
+        }
+
+        static std::string Read(const std::byte *data, std::size_t size) {
+            return {reinterpret_cast<const char *>(data), size};
+        }
+    };
+
+    /**
+     * @brief Tag byte leading every encoded result.
+     */
+    enum class WireTag : std::uint8_t {
+        Ok = 0,
+        Err = 1,
+    };
+
+    namespace internal::wire {
+        using length_t = std::uint32_t;
+
+        template<typename X, typename = void>
+        struct HasSerializer : std::false_type {};
+
+        template<typename X>
+        struct HasSerializer<X, std::void_t<decltype(Serializer<X>::Size(std::declval<const X &>()))>> : std::true_type {};
+
+        /**
+         * @brief Whether a field of type `X` is written with a length prefix through `Serializer<X>`, rather than
+         * as its raw bytes.
+         */
+        template<typename X>
+        inline constexpr bool kFramed = HasSerializer<X>::value;
+
+        template<typename X>
+        inline constexpr bool kEncodable = kFramed<X> || std::is_trivially_copyable_v<X>;
+
+        /**
+         * @brief Whether `X` is trivially copyable but refers to memory or state of the writing process, so that its
+         * raw bytes mean nothing to the reader. Such types need a `Serializer`.
+         */
+        template<typename X>
+        inline constexpr bool kPointerLike = !kFramed<X> && (std::is_pointer_v<X> || std::is_member_pointer_v<X> ||
+                                                             std::is_same_v<X, std::string_view> ||
+                                                             std::is_same_v<X, std::error_code> ||
+                                                             std::is_same_v<X, std::error_condition>);
+
+        /**
+         * @brief What a `ResultView` hands out for a field of type `X`: strings as views into the buffer, other
+         * types by value.
+         */
+        template<typename X>
+        using field_view_t = std::conditional_t<std::is_same_v<X, std::string>, std::string_view, X>;
+
+        /**
+         * @brief Number of bytes of the field, or an Err when it is too long for its 32-bit length prefix.
+         */
+        template<typename X>
+        ResultImpl<std::size_t> FieldSize(const X &value) {
+            if constexpr (kFramed<X>) {
+                auto size = Serializer<X>::Size(value);
+                if (RESULTPP_UNLIKELY(size > std::numeric_limits<length_t>::max())) {
+                    return MakeErr<ResultImpl<std::size_t>>(std::string("resultpp: field too long for its length prefix"));
+                }
+                return ResultImpl<std::size_t>(sizeof(length_t) + size);
+            } else {
+                return ResultImpl<std::size_t>(sizeof(X));
+            }
+        }
+
+        template<typename X>
+        std::byte *WriteField(const X &value, std::byte *out) {
+            if constexpr (kFramed<X>) {
+                auto length = static_cast<length_t>(Serializer<X>::Size(value));
+                std::memcpy(out, &length, sizeof(length));
+                Serializer<X>::Write(value, out + sizeof(length));
+                return out + sizeof(length) + length;
+            } else {
+                std::memcpy(out, &value, sizeof(X));
+                return out + sizeof(X);
+            }
+        }
+
+        /**
+         * @brief Number of bytes taken by the field at `data`, or `0` when `available` bytes cannot hold it.
+         */
+        template<typename X>
+        std::size_t ReadFieldSize(const std::byte *data, std::size_t available) noexcept {
+            if constexpr (kFramed<X>) {
+                if (available < sizeof(length_t)) return 0;
+                length_t length;
+                std::memcpy(&length, data, sizeof(length));
+                if (available - sizeof(length_t) < length) return 0;
+                return sizeof(length_t) + length;
+            } else {
+                return available < sizeof(X) ? 0 : sizeof(X);
+            }
+        }
+
+        template<typename X>
+        field_view_t<X> ReadField(const std::byte *data, std::size_t size) {
+            if constexpr (std::is_same_v<X, std::string>) {
+                return {reinterpret_cast<const char *>(data) + sizeof(length_t), size - sizeof(length_t)};
+            } else if constexpr (kFramed<X>) {
+                return Serializer<X>::Read(data + sizeof(length_t), size - sizeof(length_t));
+            } else {
+                X value;
+                std::memcpy(&value, data, sizeof(X));
+                return value;
+            }
+        }
+    }// namespace internal::wire
+
+    /**
+     * @brief Number of bytes `Encode` writes for `result`, or an Err when its payload or error is longer than a
+     * 32-bit length prefix can describe.
+     */
+    template<typename T, typename E>
+    internal::ResultImpl<std::size_t> EncodedSize(const internal::ResultImpl<T, E> &result) {
+        static_assert(internal::wire::kEncodable<T> && internal::wire::kEncodable<E>,
+                      "payload and error must be trivially copyable or have a resultpp::Serializer");
+        static_assert(!internal::wire::kPointerLike<T> && !internal::wire::kPointerLike<E>,
+                      "pointers, std::string_view and std::error_code are not encoded as raw bytes; add a Serializer");
+        auto field = result.IsOk() ? internal::wire::FieldSize(result.Data())
+                                   : internal::wire::FieldSize(result.Message());
+        return std::move(field).Map([](std::size_t size) { return 1 + size; });
+    }
+
+    /**
+     * @brief Encode `result` into `out`, which must hold at least `EncodedSize(result)` bytes; `EncodedSize` must
+     * have returned 'Ok'.
+     *
+     * The layout is one `WireTag` byte followed by the payload of an 'Ok' result or the error of an 'Err' result,
+     * each as raw bytes when trivially copyable, or as a 32-bit length and the bytes written by its `Serializer`.
+     * Integers are in host byte order: the encoding is meant for pipes and shared memory between processes on the
+     * same machine.
+     *
+     * @return One past the last byte written.
+     */
+    template<typename T, typename E>
+    std::byte *Encode(const internal::ResultImpl<T, E> &result, std::byte *out) {
+        static_assert(internal::wire::kEncodable<T> && internal::wire::kEncodable<E>,
+                      "payload and error must be trivially copyable or have a resultpp::Serializer");
+        static_assert(!internal::wire::kPointerLike<T> && !internal::wire::kPointerLike<E>,
+                      "pointers, std::string_view and std::error_code are not encoded as raw bytes; add a Serializer");
+        if (result.IsOk()) {
+            *out = static_cast<std::byte>(WireTag::Ok);
+            return internal::wire::WriteField(result.Data(), out + 1);
+        }
+        *out = static_cast<std::byte>(WireTag::Err);
+        return internal::wire::WriteField(result.Message(), out + 1);
+    }
+
+    /**
+     * @brief Append the encoding of `result` to `out`.
+     * @return The number of bytes appended, or the Err of `EncodedSize`, leaving `out` unchanged.
+     */
+    template<typename T, typename E>
+    internal::ResultImpl<std::size_t> Encode(const internal::ResultImpl<T, E> &result, std::vector<std::byte> &out) {
+        auto size = EncodedSize(result);
+        if (RESULTPP_UNLIKELY(size.IsErr())) return size;
+        auto offset = out.size();
+        out.resize(offset + size.Data());
+        Encode(result, out.data() + offset);
+        return size;
+    }
+
+    /**
+     * @class ResultView
+     * @brief Read-only view of one encoded `ResultImpl<T, E>` inside a byte buffer.
+     *
+     * Nothing is copied when the view is created. String payloads and errors are returned as `std::string_view`s
+     * into the buffer, trivially copyable ones are loaded on access, and other types are decoded by their
+     * `Serializer` on access. The buffer must outlive the view.
+     */
+    template<typename T, typename E = std::string>
+    class ResultView {
+        static_assert(!internal::wire::kPointerLike<T> && !internal::wire::kPointerLike<E>,
+                      "pointers, std::string_view and std::error_code are not encoded as raw bytes; add a Serializer");
+
+        const std::byte *_data = nullptr;
+        std::size_t _size = 0;
+
+        ResultView(const std::byte *data, std::size_t size) noexcept : _data(data), _size(size) {}
+
+    public:
+        ResultView() = default;
+
+        /**
+         * @brief View the record at `data` without validating it; for buffers written by `Encode`.
+         */
+        explicit ResultView(const std::byte *data) noexcept : _data(data) {
+            _size = 1 + (IsOk() ? internal::wire::ReadFieldSize<T>(data + 1, ~std::size_t{0})
+                                : internal::wire::ReadFieldSize<E>(data + 1, ~std::size_t{0}));
+        }
+
+        /**
+         * @brief Validate and view the record at the start of `available` bytes of `data`.
+         * @return The view, or an Err if the tag is unknown or the record is truncated.
+         */
+        static internal::ResultImpl<ResultView> Parse(const std::byte *data, std::size_t available) {
+            using parsed_t = internal::ResultImpl<ResultView>;
+            if (RESULTPP_UNLIKELY(available == 0)) return internal::MakeErr<parsed_t>(std::string("resultpp: empty buffer"));
+
+            auto tag = static_cast<WireTag>(*data);
+            std::size_t field = 0;
+            if (tag == WireTag::Ok) field = internal::wire::ReadFieldSize<T>(data + 1, available - 1);
+            else if (tag == WireTag::Err) field = internal::wire::ReadFieldSize<E>(data + 1, available - 1);
+            else return internal::MakeErr<parsed_t>(std::string("resultpp: unknown wire tag"));
+
+            if (RESULTPP_UNLIKELY(field == 0)) return internal::MakeErr<parsed_t>(std::string("resultpp: truncated record"));
+            return parsed_t(ResultView(data, 1 + field));
+        }
+
+        [[nodiscard]] bool IsOk() const noexcept { return static_cast<WireTag>(*_data) == WireTag::Ok; }
+
+        [[nodiscard]] bool IsErr() const noexcept { return !IsOk(); }
+
+        /**
+         * @brief The encoded payload, or a value-initialised one when the record is an 'Err'.
+         */
+        [[nodiscard]] internal::wire::field_view_t<T> Data() const {
+            if (RESULTPP_UNLIKELY(!IsOk())) return {};
+            return internal::wire::ReadField<T>(_data + 1, _size - 1);
+        }
+
+        /**
+         * @brief The encoded error, or a value-initialised one when the record is 'Ok'.
+         */
+        [[nodiscard]] internal::wire::field_view_t<E> Message() const {
+            if (RESULTPP_UNLIKELY(IsOk())) return {};
+            return internal::wire::ReadField<E>(_data + 1, _size - 1);
+        }
+
+        /**
+         * @brief Number of bytes of the record; the next record of a stream starts at `Bytes() + Size()`.
+         */
+        [[nodiscard]] std::size_t Size() const noexcept { return _size; }
+
+        [[nodiscard]] const std::byte *Bytes() const noexcept { return _data; }
+
+        /**
+         * @brief Decode the record into an owning `ResultImpl<T, E>`.
+         */
+        [[nodiscard]] internal::ResultImpl<T, E> ToResult() const {
+            if (IsOk()) return internal::ResultImpl<T, E>(T(Data()));
+            return internal::ResultImpl<T, E>(T{}, E(Message()));
+        }
+    };
+}// namespace resultpp
+
+#endif//RESULTPP_SERIALIZATION_HXX
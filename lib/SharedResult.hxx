@@ -0,0 +1,143 @@
+#ifndef RESULTPP_SHAREDRESULT_HXX
+#define RESULTPP_SHAREDRESULT_HXX
+
+#include <atomic>  // std::atomic
+#include <cstdint> // std::uint32_t
+#include <memory>  // std::shared_ptr, std::make_shared
+#include <optional>// std::optional
+#include <utility> // std::forward
+
+#include "Sync.hxx"
+#include "resultpp.hxx"
+
+#if RESULTPP_HAS_ATOMIC_WAIT
+namespace resultpp {
+    /**
+     * @class OnceResult
+     * @brief A Result computed once, by one thread, and then read by any number of threads.
+     *
+     * The first `GetOrInit` (or `Set`) fills the cell and publishes it with a release store; readers find it with a
+     * single acquire load and get a `const ResultImpl<T, E> &` to the stored Result. Threads arriving while the value
+     * is being computed block in `std::atomic::wait` (a futex on Linux) instead of on a mutex, and the computing
+     * thread only issues a wake-up when one of them actually sleeps.
+     *
+     * An 'Err' outcome is stored like any other: every reader sees the same failure and nothing is retried. If the
+     * initialiser throws instead, the cell goes back to empty and one of the waiting `GetOrInit` callers runs its
+     * own initialiser.
+     *
+     * @note The cell is neither copyable nor movable; see `SharedResult` for shared ownership.
+     */
+    template<typename T, typename E = std::string>
+    class OnceResult {
+    public:
+        using result_t = internal::ResultImpl<T, E>;
+
+        OnceResult() = default;
+        OnceResult(const OnceResult &) = delete;
+        OnceResult &operator=(const OnceResult &) = delete;
+
+        [[nodiscard]] bool IsReady() const noexcept {
+            return _state.load(std::memory_order_acquire) & internal::sync::kReady;
+        }
+
+        /**
+         * @brief The stored Result, or `nullptr` while it is not ready yet. Never blocks.
+         */
+        [[nodiscard]] const result_t *TryGet() const noexcept { return IsReady() ? &*_result : nullptr; }
+
+        /**
+         * @brief The stored Result, blocking until some thread has set it.
+         */
+        [[nodiscard]] const result_t &Get() const noexcept {
+            if (RESULTPP_UNLIKELY(!IsReady()))
+                internal::sync::WaitWhile(_state, [](std::uint32_t word) { return !(word & internal::sync::kReady); });
+            return *_result;
+        }
+
+        /**
+         * @brief The stored Result, computed by `init()` if no thread has started computing it yet.
+         *
+         * Exactly one caller runs its `init`; the others block until it is done and then return its Result.
+         */
+        template<typename F>
+        const result_t &GetOrInit(F &&init) {
+            if (RESULTPP_LIKELY(IsReady())) return *_result;
+
+            auto state = _state.load(std::memory_order_acquire);
+            while (!(state & internal::sync::kReady)) {
+                if ((state & ~internal::sync::kWaiters) == internal::sync::kEmpty) {
+                    if (!_state.compare_exchange_weak(state, state | internal::sync::kRunning, std::memory_order_acquire))
+                        continue;
+                    try {
+                        _result.emplace(std::forward<F>(init)());
+                    } catch (...) {
+                        internal::sync::Publish(_state, internal::sync::kEmpty);
+                        throw;
+                    }
+                    internal::sync::Publish(_state, internal::sync::kReady);
+                    break;
+                }
+                state = internal::sync::WaitWhile(_state, [](std::uint32_t word) {
+                    return (word & ~internal::sync::kWaiters) == internal::sync::kRunning;
+                });
+            }
+            return *_result;
+        }
+
+        /**
+         * @brief Store `result` if the cell is still empty. If copying or moving it in throws, the cell goes back to
+         * empty, so that another `Set` or `GetOrInit` can fill it, and the exception propagates.
+         * @return `false`, leaving the cell unchanged, if it was already set or being computed.
+         */
+        template<typename R>
+        bool Set(R &&result) {
+            auto state = _state.load(std::memory_order_relaxed);
+            do {
+                if ((state & ~internal::sync::kWaiters) != internal::sync::kEmpty) return false;
+            } while (!_state.compare_exchange_weak(state, state | internal::sync::kRunning, std::memory_order_acquire));
+
+            try {
+                _result.emplace(std::forward<R>(result));
+            } catch (...) {
+                internal::sync::Publish(_state, internal::sync::kEmpty);
+                throw;
+            }
+            internal::sync::Publish(_state, internal::sync::kReady);
+            return true;
+        }
+
+    private:
+        mutable std::atomic<std::uint32_t> _state{internal::sync::kEmpty};
+        std::optional<result_t> _result;
+    };
+
+    /**
+     * @class SharedResult
+     * @brief A reference-counted handle to an `OnceResult`, for values whose lifetime is shared by their readers.
+     *
+     * Copying the handle costs a reference-count increment; reading through an existing handle does not, so readers
+     * should keep a handle (or a reference to one) rather than copy it per access.
+     */
+    template<typename T, typename E = std::string>
+    class SharedResult {
+        std::shared_ptr<OnceResult<T, E>> _cell = std::make_shared<OnceResult<T, E>>();
+
+    public:
+        using result_t = typename OnceResult<T, E>::result_t;
+
+        [[nodiscard]] bool IsReady() const noexcept { return _cell->IsReady(); }
+
+        [[nodiscard]] const result_t *TryGet() const noexcept { return _cell->TryGet(); }
+
+        [[nodiscard]] const result_t &Get() const noexcept { return _cell->Get(); }
+
+        template<typename F>
+        const result_t &GetOrInit(F &&init) const { return _cell->GetOrInit(std::forward<F>(init)); }
+
+        template<typename R>
+        bool Set(R &&result) const { return _cell->Set(std::forward<R>(result)); }
+    };
+}// namespace resultpp
+#endif
+
+#endif//RESULTPP_SHAREDRESULT_HXX
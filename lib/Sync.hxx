@@ -0,0 +1,59 @@
+#ifndef RESULTPP_SYNC_HXX
+#define RESULTPP_SYNC_HXX
+
+#include <atomic> // std::atomic, std::memory_order
+#include <cstdint>// std::uint32_t
+
+#if __has_include(<version>)
+#include <version>// __cpp_lib_atomic_wait
+#endif
+
+// One-shot state words for the asynchronous types (`OnceResult`, `ResultFuture`), which block with
+// `std::atomic::wait` and therefore need C++20.
+#if defined(__cpp_lib_atomic_wait) && __cpp_lib_atomic_wait >= 201907L
+#define RESULTPP_HAS_ATOMIC_WAIT 1
+#else
+#define RESULTPP_HAS_ATOMIC_WAIT 0
+#endif
+
+#if RESULTPP_HAS_ATOMIC_WAIT
+namespace resultpp::internal::sync {
+    /**
+     * @brief Bits of a one-shot state word. `kWaiters` is set by a thread about to block, so that the thread
+     * publishing the value only pays for a wake-up when somebody sleeps.
+     */
+    inline constexpr std::uint32_t kEmpty = 0;
+    inline constexpr std::uint32_t kRunning = 1;
+    inline constexpr std::uint32_t kReady = 2;
+    inline constexpr std::uint32_t kWaiters = 4;
+
+    /**
+     * @brief Block while `pred(state)` holds.
+     * @return The first state seen, with acquire ordering, for which `pred` is false.
+     */
+    template<typename Pred>
+    std::uint32_t WaitWhile(std::atomic<std::uint32_t> &state, Pred pred) noexcept {
+        auto seen = state.load(std::memory_order_acquire);
+        while (pred(seen)) {
+            if (!(seen & kWaiters) &&
+                !state.compare_exchange_weak(seen, seen | kWaiters, std::memory_order_acquire, std::memory_order_acquire))
+                continue;
+            state.wait(seen | kWaiters, std::memory_order_acquire);
+            seen = state.load(std::memory_order_acquire);
+        }
+        return seen;
+    }
+
+    /**
+     * @brief Replace the state with `to` (release), waking the threads blocked in `WaitWhile` if any registered.
+     * @return The previous state, without `kWaiters`.
+     */
+    inline std::uint32_t Publish(std::atomic<std::uint32_t> &state, std::uint32_t to) noexcept {
+        auto previous = state.exchange(to, std::memory_order_acq_rel);
+        if (previous & kWaiters) state.notify_all();
+        return previous & ~kWaiters;
+    }
+}// namespace resultpp::internal::sync
+#endif
+
+#endif//RESULTPP_SYNC_HXX
@@ -0,0 +1,262 @@
+#ifndef RESULTPP_TASK_GRAPH_HXX
+#define RESULTPP_TASK_GRAPH_HXX
+
+#include <atomic>     // std::atomic
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint32_t
+#include <memory>     // std::make_shared, std::shared_ptr, std::unique_ptr
+#include <optional>   // std::optional
+#include <tuple>      // std::tuple, std::apply
+#include <type_traits>// std::conditional_t, std::decay_t, std::invoke_result_t, std::is_same_v
+#include <utility>    // std::move
+#include <vector>     // std::vector
+
+#include "Executor.hxx"
+#include "Sync.hxx"
+
+#if RESULTPP_HAS_ATOMIC_WAIT
+namespace resultpp {
+    /**
+     * @brief Where a node of a `TaskGraph` stands after a run.
+     */
+    enum class NodeStatus {
+        Pending,///< Not run yet.
+        Ok,     ///< Ran and returned an 'Ok'.
+        Failed, ///< Ran and returned an 'Err'.
+        Skipped,///< Not run, because an ancestor failed; holds that ancestor's error.
+    };
+
+    template<typename E>
+    class TaskGraph;
+
+    namespace internal::graph {
+        /**
+         * @class NodeBase
+         * @brief Untyped part of a node: its edges, the count of parents still running, and its status.
+         */
+        template<typename E>
+        class NodeBase {
+        public:
+            std::vector<NodeBase *> dependents;
+            std::uint32_t parents = 0;
+            std::atomic<std::uint32_t> waiting{0};
+            NodeStatus status = NodeStatus::Pending;
+
+            virtual ~NodeBase() = default;
+
+            /**
+             * @brief Run the callable, or skip it when a parent did not succeed. Called once every parent is done.
+             */
+            virtual void Run() noexcept = 0;
+
+            /**
+             * @brief The error of a failed or skipped node.
+             */
+            [[nodiscard]] virtual const E &Error() const noexcept = 0;
+
+            virtual void Reset() noexcept = 0;
+        };
+
+        template<typename T, typename E>
+        class ValueNode : public NodeBase<E> {
+        public:
+            std::optional<ResultImpl<T, E>> result;
+
+            [[nodiscard]] const E &Error() const noexcept override { return result->Message(); }
+
+            void Reset() noexcept override {
+                result.reset();
+                this->status = NodeStatus::Pending;
+                this->waiting.store(this->parents, std::memory_order_relaxed);
+            }
+        };
+
+        template<typename F, typename E, typename... Ts>
+        using node_result_t = std::conditional_t<IsResult<std::decay_t<std::invoke_result_t<F &, const Ts &...>>>::value,
+                                                 std::decay_t<std::invoke_result_t<F &, const Ts &...>>,
+                                                 ResultImpl<std::decay_t<std::invoke_result_t<F &, const Ts &...>>, E>>;
+
+        /**
+         * @class FuncNode
+         * @brief A node calling `func(const Ts &...)` with the payloads of its parents.
+         */
+        template<typename R, typename F, typename... Ts>
+        class FuncNode final : public ValueNode<typename R::value_type, typename R::error_type> {
+            using error_t = typename R::error_type;
+
+            F _func;
+            std::tuple<ValueNode<Ts, error_t> *...> _parents;
+
+        public:
+            FuncNode(F func, ValueNode<Ts, error_t> *...parents) : _func(std::move(func)), _parents(parents...) {}
+
+            void Run() noexcept override {
+                const NodeBase<error_t> *failed = nullptr;
+                std::apply([&](auto *...parent) { ((failed = failed ? failed : FailedOrNull(parent)), ...); }, _parents);
+                if (RESULTPP_UNLIKELY(failed != nullptr)) {
+                    Skip(*failed);
+                    return;
+                }
+                this->result.emplace(std::apply([this](auto *...parent) { return R(_func(parent->result->Data()...)); }, _parents));
+                this->status = this->result->IsOk() ? NodeStatus::Ok : NodeStatus::Failed;
+            }
+
+        private:
+            static const NodeBase<error_t> *FailedOrNull(const NodeBase<error_t> *parent) noexcept {
+                return parent->status == NodeStatus::Ok ? nullptr : parent;
+            }
+
+            RESULTPP_COLD void Skip(const NodeBase<error_t> &failed) noexcept {
+                this->result.emplace(PropagateErr<R>(failed.Error()));
+                this->status = NodeStatus::Skipped;
+            }
+        };
+
+        /**
+         * @brief Signalled by the last node of a run. Shared, so that the thread signalling it keeps it alive while
+         * the waiting one returns and possibly destroys the graph.
+         */
+        struct Completion {
+            std::atomic<std::uint32_t> state{sync::kEmpty};
+        };
+    }// namespace internal::graph
+
+    /**
+     * @class GraphNode
+     * @brief Handle to a node of a `TaskGraph` whose callable yields a `ResultImpl<T, E>`.
+     */
+    template<typename T, typename E = std::string>
+    class GraphNode {
+        template<typename>
+        friend class TaskGraph;
+
+        internal::graph::ValueNode<T, E> *_node = nullptr;
+
+        explicit GraphNode(internal::graph::ValueNode<T, E> *node) noexcept : _node(node) {}
+
+    public:
+        GraphNode() = default;
+    };
+
+    /**
+     * @struct GraphSummary
+     * @brief Node counts by outcome after `TaskGraph::Run`.
+     */
+    struct GraphSummary {
+        std::size_t ok = 0;
+        std::size_t failed = 0;
+        std::size_t skipped = 0;
+    };
+
+    /**
+     * @class TaskGraph
+     * @brief A DAG of fallible steps, each a function of its parents' payloads, run on an `Executor`.
+     *
+     * A node becomes ready when its last parent finishes, and ready nodes run in parallel: the worker finishing a
+     * parent runs one newly ready dependent itself and posts the others, so a chain stays on one worker while a fan
+     * out spreads through work stealing. A node whose parent failed or was skipped is not run; it is marked skipped
+     * and holds the failed ancestor's error, and so on down every transitive dependent.
+     *
+     * Nodes are added after their parents, so the graph is acyclic by construction. Callables must not throw.
+     */
+    template<typename E = std::string>
+    class TaskGraph {
+        using node_t = internal::graph::NodeBase<E>;
+
+        std::vector<std::unique_ptr<node_t>> _nodes;
+        std::vector<node_t *> _roots;
+        Executor *_executor = nullptr;
+        std::atomic<std::size_t> _remaining{0};
+        std::shared_ptr<internal::graph::Completion> _completion;
+
+    public:
+        TaskGraph() = default;
+        TaskGraph(const TaskGraph &) = delete;
+        TaskGraph &operator=(const TaskGraph &) = delete;
+
+        /**
+         * @brief Add a node calling `func(const Ts &...)` with the payloads of `parents`, once they all succeed.
+         *
+         * `func` returns a `ResultImpl<T, E>` or a plain `T`.
+         */
+        template<typename F, typename... Ts>
+        auto Add(F func, GraphNode<Ts, E>... parents) {
+            using result_t = internal::graph::node_result_t<F, E, Ts...>;
+            using value_t = typename result_t::value_type;
+            static_assert(std::is_same_v<typename result_t::error_type, E>, "a node must return the graph's error type");
+
+            auto node = std::make_unique<internal::graph::FuncNode<result_t, F, Ts...>>(std::move(func), parents._node...);
+            auto *raw = node.get();
+            raw->parents = static_cast<std::uint32_t>(sizeof...(Ts));
+            (parents._node->dependents.push_back(raw), ...);
+            if constexpr (sizeof...(Ts) == 0) _roots.push_back(raw);
+            _nodes.push_back(std::move(node));
+            return GraphNode<value_t, E>(raw);
+        }
+
+        [[nodiscard]] std::size_t Size() const noexcept { return _nodes.size(); }
+
+        /**
+         * @brief Run every node on `executor` and block until all are done or skipped. The outcomes of a previous run
+         * are discarded. Must not be called from one of `executor`'s workers.
+         */
+        GraphSummary Run(Executor &executor) {
+            GraphSummary summary;
+            if (_nodes.empty()) return summary;
+
+            for (auto &node : _nodes) node->Reset();
+            _executor = &executor;
+            _completion = std::make_shared<internal::graph::Completion>();
+            _remaining.store(_nodes.size(), std::memory_order_relaxed);
+            auto completion = _completion;
+            for (auto *root : _roots) Post(root);
+            internal::sync::WaitWhile(completion->state, [](std::uint32_t word) { return !(word & internal::sync::kReady); });
+
+            for (auto &node : _nodes) {
+                if (node->status == NodeStatus::Ok) ++summary.ok;
+                else if (node->status == NodeStatus::Failed) ++summary.failed;
+                else ++summary.skipped;
+            }
+            return summary;
+        }
+
+        /**
+         * @brief The outcome of `node` in the last run.
+         */
+        template<typename T>
+        [[nodiscard]] const internal::ResultImpl<T, E> &Get(GraphNode<T, E> node) const noexcept { return *node._node->result; }
+
+        template<typename T>
+        [[nodiscard]] NodeStatus Status(GraphNode<T, E> node) const noexcept { return node._node->status; }
+
+    private:
+        void Post(node_t *node) {
+            _executor->Post([this, node] { Execute(node); });
+        }
+
+        /**
+         * @brief Run `node`, then, as long as exactly one dependent becomes ready, keep going with it on this thread;
+         * the other ready dependents are posted.
+         */
+        void Execute(node_t *node) noexcept {
+            while (node != nullptr) {
+                node->Run();
+                node_t *next = nullptr;
+                for (auto *dependent : node->dependents) {
+                    if (dependent->waiting.fetch_sub(1, std::memory_order_acq_rel) != 1) continue;
+                    if (next == nullptr) next = dependent;
+                    else Post(dependent);
+                }
+                if (_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    auto completion = _completion;
+                    internal::sync::Publish(completion->state, internal::sync::kReady);
+                    return;
+                }
+                node = next;
+            }
+        }
+    };
+}// namespace resultpp
+#endif
+
+#endif//RESULTPP_TASK_GRAPH_HXX
@@ -0,0 +1,183 @@
+#ifndef RESULTPP_VIEWS_HXX
+#define RESULTPP_VIEWS_HXX
+
+#include <optional>   // std::optional
+#include <type_traits>// std::decay_t, std::invoke_result_t, std::is_lvalue_reference_v
+#include <utility>    // std::forward, std::move
+
+#if __has_include(<version>)
+#include <version>// __cpp_lib_ranges
+#endif
+
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+#include <ranges>// std::ranges::view_interface, std::views::all, std::views::filter, std::views::transform
+#define RESULTPP_HAS_RANGES 1
+#else
+#define RESULTPP_HAS_RANGES 0
+#endif
+
+#include "resultpp.hxx"
+
+#if RESULTPP_HAS_RANGES
+namespace resultpp {
+    namespace internal::views {
+        struct IsOkFn {
+            template<typename R>
+            bool operator()(const R &result) const noexcept { return result.IsOk(); }
+        };
+
+        struct IsErrFn {
+            template<typename R>
+            bool operator()(const R &result) const noexcept { return result.IsErr(); }
+        };
+
+        struct DataFn {
+            template<typename R>
+            decltype(auto) operator()(R &result) const noexcept { return (result.Data()); }
+        };
+
+        struct MessageFn {
+            template<typename R>
+            decltype(auto) operator()(R &result) const noexcept { return (result.Message()); }
+        };
+
+        /**
+         * @class CacheView
+         * @brief Single-pass view holding the current element, so that a filter testing it and a projection
+         * reading it see the same object and the underlying range is read once per element.
+         */
+        template<std::ranges::view V>
+        class CacheView : public std::ranges::view_interface<CacheView<V>> {
+            V _base;
+            std::optional<std::ranges::range_value_t<V>> _cache;
+
+        public:
+            class Iterator {
+                CacheView *_parent = nullptr;
+                std::ranges::iterator_t<V> _current{};
+
+            public:
+                using iterator_concept = std::input_iterator_tag;
+                using value_type = std::ranges::range_value_t<V>;
+                using difference_type = std::ranges::range_difference_t<V>;
+
+                Iterator() = default;
+
+                Iterator(CacheView &parent, std::ranges::iterator_t<V> current)
+                    : _parent(&parent), _current(std::move(current)) {}
+
+                value_type &operator*() const {
+                    if (!_parent->_cache) _parent->_cache.emplace(*_current);
+                    return *_parent->_cache;
+                }
+
+                Iterator &operator++() {
+                    ++_current;
+                    _parent->_cache.reset();
+                    return *this;
+                }
+
+                void operator++(int) { ++*this; }
+
+                friend bool operator==(const Iterator &it, const std::ranges::sentinel_t<V> &end) {
+                    return it._current == end;
+                }
+            };
+
+            CacheView() = default;
+
+            explicit CacheView(V base) : _base(std::move(base)) {}
+
+            Iterator begin() {
+                _cache.reset();
+                return Iterator(*this, std::ranges::begin(_base));
+            }
+
+            std::ranges::sentinel_t<V> end() { return std::ranges::end(_base); }
+        };
+
+        /**
+         * @brief Keep the elements satisfying `Pred` and project them through `Proj`. Ranges yielding references
+         * go straight through `std::views::filter`; ranges yielding Results by value go through a `CacheView`
+         * first, since the filter reads an element twice, to test it and to hand it on.
+         */
+        template<typename Pred, typename Proj>
+        struct SelectFn {
+            template<std::ranges::viewable_range R>
+            auto operator()(R &&range) const {
+                if constexpr (std::is_lvalue_reference_v<std::ranges::range_reference_t<R>>) {
+                    return std::forward<R>(range) | std::views::filter(Pred{}) | std::views::transform(Proj{});
+                } else {
+                    return CacheView(std::views::all(std::forward<R>(range))) | std::views::filter(Pred{}) |
+                           std::views::transform(Proj{});
+                }
+            }
+
+            template<std::ranges::viewable_range R>
+            friend auto operator|(R &&range, const SelectFn &select) {
+                return select(std::forward<R>(range));
+            }
+        };
+
+        /**
+         * @brief `FlatMap` when `F` returns a Result, `Map` otherwise; an Err element keeps its error.
+         */
+        template<typename F>
+        struct TransformOkFn {
+            F func;
+
+            template<typename R>
+            auto operator()(R &&result) const {
+                using payload_t = decltype(std::forward<R>(result).Data());
+                if constexpr (IsResult<std::decay_t<std::invoke_result_t<const F &, payload_t>>>::value) {
+                    return std::forward<R>(result).FlatMap(func);
+                } else {
+                    return std::forward<R>(result).Map(func);
+                }
+            }
+        };
+    }// namespace internal::views
+
+    /**
+     * @brief Lazy range adaptors over ranges of Results, composing with `std::views`.
+     *
+     * @code
+     * std::vector<resultpp::Result<int>> results = Load();
+     * for (const int &value : results | resultpp::views::ok_values) Use(value);
+     * for (const auto &error : results | resultpp::views::errors | std::views::take(10)) Log(error);
+     * auto parsed = lines | resultpp::views::transform_ok(Parse);   // a range of Results
+     * @endcode
+     *
+     * `ok_values` and `errors` neither allocate nor copy: payloads and errors are handed out by reference into the
+     * underlying range. When the range yields Results by value, such as the output of `transform_ok`, each one is
+     * produced once and held by the view while it is tested and read, so the result is a single-pass range and
+     * the references last until the iterator moves on. Both take a range on their left; they do not combine with
+     * other adaptors before one is given. `transform_ok` builds a Result each time an element is read, carrying
+     * over the error of an 'Err' element.
+     */
+    namespace views {
+        /**
+         * @brief The payloads of the 'Ok' elements.
+         */
+        inline constexpr internal::views::SelectFn<internal::views::IsOkFn, internal::views::DataFn> ok_values{};
+
+        /**
+         * @brief The errors of the 'Err' elements.
+         */
+        inline constexpr internal::views::SelectFn<internal::views::IsErrFn, internal::views::MessageFn> errors{};
+
+        /**
+         * @brief Apply `func` to the payload of every 'Ok' element, yielding one Result per element.
+         *
+         * `func` may be fallible, returning a Result (as for `FlatMap`), or return a plain value (as for `Map`).
+         * 'Err' elements yield an 'Err' Result with a copy of their error.
+         */
+        template<typename F>
+        constexpr auto transform_ok(F &&func) {
+            return std::views::transform(internal::views::TransformOkFn<std::decay_t<F>>{std::forward<F>(func)});
+        }
+    }// namespace views
+}// namespace resultpp
+#endif
+
+#endif//RESULTPP_VIEWS_HXX
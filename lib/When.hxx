@@ -0,0 +1,197 @@
+#ifndef RESULTPP_WHEN_HXX
+#define RESULTPP_WHEN_HXX
+
+#include <atomic>     // std::atomic
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint32_t
+#include <iterator>   // std::begin, std::end, std::size
+#include <memory>     // std::make_shared, std::shared_ptr
+#include <optional>   // std::optional
+#include <tuple>      // std::tuple
+#include <type_traits>// std::decay_t, std::enable_if_t
+#include <utility>    // std::index_sequence, std::move
+#include <vector>     // std::vector
+
+#include "Cancellation.hxx"
+#include "Future.hxx"
+
+#if RESULTPP_HAS_ATOMIC_WAIT
+namespace resultpp {
+    namespace internal::when {
+        /**
+         * @brief Set in the counter once the combined future is settled early (first error of `WhenAll`, first
+         * success of `WhenAny`); the remaining count lives in the low bits.
+         */
+        inline constexpr std::uint32_t kSettled = 1U << 31U;
+
+        template<typename F>
+        struct IsFuture : std::false_type {};
+
+        template<typename T, typename E>
+        struct IsFuture<ResultFuture<T, E>> : std::true_type {};
+
+        template<typename Range>
+        using range_future_t = std::decay_t<decltype(*std::begin(std::declval<Range &>()))>;
+
+        /**
+         * @brief Shared by the callbacks of one combinator: the countdown, the slots filled by the inputs and the
+         * promise of the combined future, set by exactly one callback.
+         */
+        template<typename Out, typename E, typename Slots>
+        struct Gather {
+            std::atomic<std::uint32_t> pending;
+            Slots slots;
+            ResultPromise<Out, E> promise;
+            std::optional<CancellationSource> source;
+
+            Gather(std::uint32_t count, Slots initial, std::optional<CancellationSource> cancel)
+                : pending(count), slots(std::move(initial)), source(std::move(cancel)) {}
+
+            void Cancel() {
+                if (source) source->Cancel();
+            }
+        };
+
+        /**
+         * @brief `WhenAll` step for one input: an 'Ok' fills its slot and counts down, the last one settles the
+         * combined future; the first 'Err' settles it at once and cancels the others.
+         */
+        template<typename State, typename Slot, typename Result, typename Build>
+        void AllStep(State &state, Slot &slot, Result &&result, Build build) {
+            using out_t = typename decltype(state.promise)::result_t;
+            if (RESULTPP_LIKELY(result.IsOk())) {
+                slot.emplace(std::move(result).Data());
+                if (state.pending.fetch_sub(1, std::memory_order_acq_rel) == 1) state.promise.Set(build());
+            } else if (!(state.pending.fetch_or(kSettled, std::memory_order_acq_rel) & kSettled)) {
+                state.Cancel();
+                state.promise.Set(PropagateErr<out_t>(std::move(result).Message()));
+            }
+        }
+
+        /**
+         * @brief `WhenAny` step for one input: the first 'Ok' settles the combined future and cancels the others; an
+         * 'Err' counts down, and the last one settles it with its error when nothing succeeded.
+         */
+        template<typename State, typename Result>
+        void AnyStep(State &state, Result &&result) {
+            if (result.IsOk()) {
+                if (!(state.pending.fetch_or(kSettled, std::memory_order_acq_rel) & kSettled)) {
+                    state.Cancel();
+                    state.promise.Set(std::move(result));
+                }
+            } else if (state.pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                state.promise.Set(std::move(result));
+            }
+        }
+
+        template<typename E, typename... Ts, std::size_t... I>
+        ResultFuture<std::tuple<Ts...>, E> AllOf(std::optional<CancellationSource> source, std::index_sequence<I...>,
+                                                 ResultFuture<Ts, E> &&...futures) {
+            using slots_t = std::tuple<std::optional<Ts>...>;
+            using state_t = Gather<std::tuple<Ts...>, E, slots_t>;
+            if constexpr (sizeof...(Ts) == 0) {
+                return ResultFuture<std::tuple<>, E>::Ready(std::tuple<>());
+            } else {
+                auto state = std::make_shared<state_t>(static_cast<std::uint32_t>(sizeof...(Ts)), slots_t{}, std::move(source));
+                auto future = state->promise.GetFuture();
+                auto build = [&slots = state->slots] { return std::tuple<Ts...>(std::move(*std::get<I>(slots))...); };
+                (std::move(futures).OnReady([state, build](typename ResultFuture<Ts, E>::result_t &&result) {
+                    AllStep(*state, std::get<I>(state->slots), std::move(result), build);
+                }),
+                 ...);
+                return future;
+            }
+        }
+    }// namespace internal::when
+
+    /**
+     * @brief A future of all the payloads of `futures`, or of the first error among them.
+     *
+     * The inputs complete through one atomic counter: each 'Ok' stores its payload and counts down, and the last one
+     * sets the combined future. The first 'Err' sets it right away; the payloads that arrive later are dropped.
+     */
+    template<typename E, typename... Ts>
+    ResultFuture<std::tuple<Ts...>, E> WhenAll(ResultFuture<Ts, E> &&...futures) {
+        return internal::when::AllOf(std::nullopt, std::index_sequence_for<Ts...>{}, std::move(futures)...);
+    }
+
+    /**
+     * @brief As `WhenAll(futures...)`, also cancelling `source` on the first error so that the sibling operations
+     * holding its tokens can stop.
+     */
+    template<typename E, typename... Ts>
+    ResultFuture<std::tuple<Ts...>, E> WhenAll(CancellationSource source, ResultFuture<Ts, E> &&...futures) {
+        return internal::when::AllOf(std::move(source), std::index_sequence_for<Ts...>{}, std::move(futures)...);
+    }
+
+    /**
+     * @brief Range form of `WhenAll`: the futures in `futures` (moved from) become a future of a vector of their
+     * payloads, in order, or of the first error. `source`, if given, is cancelled on the first error.
+     */
+    template<typename Range, typename Future = internal::when::range_future_t<Range>,
+             typename = std::enable_if_t<internal::when::IsFuture<Future>::value>>
+    auto WhenAll(Range &&futures, std::optional<CancellationSource> source = std::nullopt) {
+        using value_t = typename Future::result_t::value_type;
+        using error_t = typename Future::result_t::error_type;
+        using slots_t = std::vector<std::optional<value_t>>;
+        using state_t = internal::when::Gather<std::vector<value_t>, error_t, slots_t>;
+
+        auto count = static_cast<std::uint32_t>(std::size(futures));
+        if (count == 0) return ResultFuture<std::vector<value_t>, error_t>::Ready(std::vector<value_t>());
+
+        auto state = std::make_shared<state_t>(count, slots_t(count), std::move(source));
+        auto future = state->promise.GetFuture();
+        auto build = [&slots = state->slots] {
+            std::vector<value_t> values;
+            values.reserve(slots.size());
+            for (auto &slot : slots) values.push_back(std::move(*slot));
+            return values;
+        };
+        std::size_t index = 0;
+        for (auto &input : futures) {
+            std::move(input).OnReady([state, build, index](typename Future::result_t &&result) {
+                internal::when::AllStep(*state, state->slots[index], std::move(result), build);
+            });
+            ++index;
+        }
+        return future;
+    }
+
+    /**
+     * @brief A future of the first 'Ok' among `futures` (moved from), or of the last error when all of them fail.
+     *
+     * Settled through one atomic counter like `WhenAll`. `source`, if given, is cancelled once a winner is known so
+     * that the losing operations can stop. Over no futures at all, the result is `AsyncErrors<E>::BrokenPromise()`.
+     */
+    template<typename Range, typename Future = internal::when::range_future_t<Range>,
+             typename = std::enable_if_t<internal::when::IsFuture<Future>::value>>
+    Future WhenAny(Range &&futures, std::optional<CancellationSource> source = std::nullopt) {
+        using value_t = typename Future::result_t::value_type;
+        using error_t = typename Future::result_t::error_type;
+        using state_t = internal::when::Gather<value_t, error_t, std::tuple<>>;
+
+        auto state = std::make_shared<state_t>(static_cast<std::uint32_t>(std::size(futures)), std::tuple<>(), std::move(source));
+        auto future = state->promise.GetFuture();
+        for (auto &input : futures) {
+            std::move(input).OnReady([state](typename Future::result_t &&result) {
+                internal::when::AnyStep(*state, std::move(result));
+            });
+        }
+        return future;
+    }
+
+    /**
+     * @brief Variadic form of `WhenAny`, over futures of the same type.
+     */
+    template<typename T, typename E, typename... Rest>
+    ResultFuture<T, E> WhenAny(ResultFuture<T, E> &&first, Rest &&...rest) {
+        std::vector<ResultFuture<T, E>> futures;
+        futures.reserve(1 + sizeof...(Rest));
+        futures.push_back(std::move(first));
+        (futures.push_back(std::move(rest)), ...);
+        return WhenAny(futures);
+    }
+}// namespace resultpp
+#endif
+
+#endif//RESULTPP_WHEN_HXX
@@ -4,8 +4,8 @@
 #include "ResultImpl.hxx"
 
 namespace resultpp {
-    template<typename T>
-    using Result = internal::ResultImpl<T>;
+    template<typename T, typename E = std::string>
+    using Result = internal::ResultImpl<T, E>;
 }
 
 #endif//RESULTPP_RESULTPP_HXX
\ No newline at end of file
@@ -0,0 +1,20 @@
+#include "allocations.hxx"
+
+#include <cstdlib>// std::free, std::malloc
+#include <new>    // std::bad_alloc
+
+namespace {
+    std::size_t allocations = 0;
+}// namespace
+
+std::size_t resultpp::test::Allocations() noexcept { return allocations; }
+
+void *operator new(std::size_t size) {
+    ++allocations;
+    if (void *p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
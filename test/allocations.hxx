@@ -0,0 +1,14 @@
+#ifndef RESULTPP_TEST_ALLOCATIONS_HXX
+#define RESULTPP_TEST_ALLOCATIONS_HXX
+
+#include <cstddef>// std::size_t
+
+namespace resultpp::test {
+    /**
+     * @brief Calls to the global `operator new` so far. Suites built with `ALLOCATIONS` link allocations.cxx, which
+     * replaces the global allocation functions to count them.
+     */
+    std::size_t Allocations() noexcept;
+}// namespace resultpp::test
+
+#endif//RESULTPP_TEST_ALLOCATIONS_HXX
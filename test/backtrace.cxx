@@ -0,0 +1,46 @@
+#include <resultpp.hxx>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// The backtrace hook with RESULTPP_ENABLE_BACKTRACE: an error is reported once, where it is created, and not again
+// by every combinator that passes it on, so sampling and counts do not grow with the depth of a pipeline.
+namespace {
+    using Result = resultpp::Result<int>;
+
+    Result Fail() { return Result(0, std::string("disk full")); }
+
+    Result Increment(int v) { return Result(v + 1); }
+}// namespace
+
+int main() {
+    resultpp::SetBacktraceSampling(1);
+    auto before = resultpp::ErrorsSeen();
+    auto failed = Fail();
+    Check("creating an Err reports it", resultpp::ErrorsSeen() == before + 1);
+
+    before = resultpp::ErrorsSeen();
+    auto captured = resultpp::BacktracesCaptured();
+    auto eager = failed.Map([](int v) { return v + 1; })
+                         .FlatMap(Increment)
+                         .AndThen([](int v) { return static_cast<long>(v); })
+                         .Map([](long v) { return std::to_string(v); });
+    auto moved = Fail().Map([](int v) { return v * 2; }).FlatMap(Increment).Map([](int v) { return v > 0; });
+    Check("Map, FlatMap and AndThen pass an Err on without reporting it",
+          eager.IsErr() && moved.IsErr() && resultpp::ErrorsSeen() == before + 1 &&
+                  resultpp::BacktracesCaptured() == captured + 1);
+
+    before = resultpp::ErrorsSeen();
+    auto lazy = failed.Lazy().Map([](int v) { return v + 1; }).FlatMap(Increment).Map([](int v) { return v * 3; }).Eval();
+    Check("a lazy chain passes an Err on without reporting it", lazy.IsErr() && resultpp::ErrorsSeen() == before);
+
+    before = resultpp::ErrorsSeen();
+    auto recovered = failed.OrElse([](const std::string &) { return Result(0, std::string("still failing")); });
+    Check("an error made by OrElse is reported", recovered.IsErr() && resultpp::ErrorsSeen() == before + 1);
+    return resultpp::test::Finish();
+}
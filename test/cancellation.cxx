@@ -0,0 +1,120 @@
+#include <Parallel.hxx>
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// One CancellationSource stopping a parallel job: the first failing element of ParallelTransform cancels the rest,
+// an outside Cancel skips what has not started, and callbacks, Submit and Then continuations observe the same token.
+int main() {
+#if RESULTPP_HAS_ATOMIC_WAIT
+    using resultpp::Result;
+
+    resultpp::Executor pool(4);
+    std::vector<int> input(100'000);
+    for (int i = 0; i < static_cast<int>(input.size()); ++i) input[i] = i;
+
+    {
+        auto squares = resultpp::ParallelTransform(pool, input, [](int v) { return static_cast<long>(v) * v; }).Get();
+        Check("ParallelTransform keeps the input order", squares.IsOk() && squares.Data()[99'999] == 99'999L * 99'999);
+    }
+
+    {
+        resultpp::CancellationSource source;
+        std::atomic<int> calls{0};
+        std::atomic<int> notified{0};
+        auto registration = source.Token().OnCancel([&] { notified.fetch_add(1); });
+        auto result = resultpp::ParallelTransform(
+                              pool, input,
+                              [&](int v) {
+                                  calls.fetch_add(1, std::memory_order_relaxed);
+                                  if (v == 10) return Result<int>(0, std::string("bad record 10"));
+                                  return Result<int>(v);
+                              },
+                              source)
+                              .Get();
+        Check("the first error settles the job", result.IsErr() && result.Message() == "bad record 10");
+        Check("and cancels the source, running its callback once", source.IsCancelled() && notified.load() == 1);
+        Check("so most elements are never transformed", calls.load() < static_cast<int>(input.size()));
+    }
+
+    {
+        resultpp::CancellationSource source;
+        source.Cancel();
+        auto result = resultpp::ParallelTransform(pool, input, [](int v) { return v; }, source).Get();
+        Check("a job cancelled from outside is Cancelled", resultpp::IsCancelled(result));
+    }
+
+    {
+        resultpp::CancellationSource source;
+        auto token = source.Token();
+        source.Cancel();
+        auto skipped = pool.Submit(token, [] { return 1; }).Get();
+        Check("Submit with a cancelled token skips the task", resultpp::IsCancelled(skipped));
+
+        auto chained = pool.Submit([] { return 1; }).Then(pool, resultpp::Cancellable(token, [](int v) { return v + 1; }));
+        Check("a Cancellable continuation is skipped", resultpp::IsCancelled(std::move(chained).Get()));
+    }
+
+    {
+        resultpp::CancellationSource source;
+        int calls = 0;
+        {
+            auto dropped = source.Token().OnCancel([&] { ++calls; });
+        }
+        auto kept = source.Token().OnCancel([&] { calls += 10; });
+        source.Cancel();
+        Check("only the kept registration is called", calls == 10);
+        auto late = source.Token().OnCancel([&] { calls += 100; });
+        Check("registering after Cancel calls back at once", calls == 110);
+    }
+
+    {
+        // The callback takes a user lock that another thread holds while it drops a registration still queued.
+        resultpp::CancellationSource source;
+        std::mutex lock;
+        std::atomic<bool> holding{false};
+        std::atomic<bool> started{false};
+        std::atomic<int> calls{0};
+        auto first = source.Token().OnCancel([&] {
+            started = true;
+            std::lock_guard<std::mutex> guard(lock);
+            ++calls;
+        });
+        std::optional<resultpp::CancellationRegistration> second = source.Token().OnCancel([&] { calls += 10; });
+        std::thread dropper([&] {
+            std::lock_guard<std::mutex> guard(lock);
+            holding = true;
+            while (!started) std::this_thread::yield();
+            second.reset();
+        });
+        while (!holding) std::this_thread::yield();
+        source.Cancel();
+        dropper.join();
+        Check("a callback may take a lock held while dropping another one", calls == 1);
+    }
+
+    {
+        resultpp::CancellationSource source;
+        std::optional<resultpp::CancellationRegistration> self;
+        int calls = 0;
+        self = source.Token().OnCancel([&] {
+            ++calls;
+            self.reset();
+        });
+        source.Cancel();
+        Check("a callback may drop its own registration", calls == 1 && !self);
+    }
+    return resultpp::test::Finish();
+#else
+    return resultpp::test::Skip("std::atomic::wait is not available");
+#endif
+}
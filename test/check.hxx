@@ -0,0 +1,42 @@
+#ifndef RESULTPP_TEST_CHECK_HXX
+#define RESULTPP_TEST_CHECK_HXX
+
+#include <cstdio>// std::printf
+
+namespace resultpp::test {
+    /**
+     * @brief Exit code telling CTest that a suite was skipped, set as `SKIP_RETURN_CODE` by `resultpp_add_test`.
+     */
+    inline constexpr int kSkipped = 77;
+
+    /**
+     * @brief Checks failed so far by the running suite.
+     */
+    inline int failures = 0;
+
+    /**
+     * @brief Report `step` as passed or failed, counting failures.
+     */
+    inline void Check(const char *step, bool ok) {
+        std::printf("%-60s %s\n", step, ok ? "ok" : "FAILED");
+        if (!ok) ++failures;
+    }
+
+    /**
+     * @brief Exit code of a suite: non-zero when any check failed.
+     */
+    inline int Finish() {
+        if (failures != 0) std::printf("%d check(s) failed\n", failures);
+        return failures == 0 ? 0 : 1;
+    }
+
+    /**
+     * @brief Exit code of a suite that cannot run in this configuration.
+     */
+    inline int Skip(const char *reason) {
+        std::printf("skipped: %s\n", reason);
+        return kSkipped;
+    }
+}// namespace resultpp::test
+
+#endif//RESULTPP_TEST_CHECK_HXX
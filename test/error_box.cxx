@@ -0,0 +1,78 @@
+#include <ErrorBox.hxx>
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+#include "allocations.hxx"
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// One Result type for an application layer carrying structured errors from several lower layers in an ErrorBox:
+// small errors stay in place, large ones are allocated, and callers recover the concrete type with As<E>(). The global
+// allocation functions count every call to check that small errors never allocate.
+namespace {
+    struct ParseError {
+        int line;
+        int column;
+    };
+
+    struct QuotaError {
+        std::string tenant;
+        long long used;
+        long long limit;
+    };
+
+    struct ConfigError : std::runtime_error {
+        using std::runtime_error::runtime_error;
+    };
+
+
+    using Result = resultpp::Result<int, resultpp::ErrorBox>;
+
+    Result Parse(int input) {
+        if (input < 0) return Result(0, ParseError{3, -input});
+        return Result(input);
+    }
+
+    Result Charge(int amount) {
+        if (amount > 100) return Result(0, QuotaError{"acme", amount, 100});
+        return Result(amount);
+    }
+}// namespace
+
+int main() {
+    auto before = resultpp::test::Allocations();
+    int column = 0;
+    for (int input = -500; input < 500; ++input) {
+        auto result = Parse(input).Map([](int v) { return v * 2; });
+        if (const auto *error = result.Message().As<ParseError>()) column += error->column;
+    }
+    Check("small errors are boxed in place", resultpp::test::Allocations() == before && column > 0);
+
+    auto parsed = Parse(-7);
+    Check("a boxed error fails the Result", parsed.IsErr() && parsed.Message().Is<ParseError>());
+    Check("As returns the concrete error", parsed.Message().As<ParseError>()->column == 7);
+    Check("As of another type is null", parsed.Message().As<QuotaError>() == nullptr);
+
+    auto charged = Charge(250).FlatMap([](int v) { return Parse(v); });
+    const auto *quota = charged.Message().As<QuotaError>();
+    Check("large errors are boxed on the heap", quota != nullptr && quota->tenant == "acme" && quota->used == 250);
+
+    auto copy = charged;
+    Check("copies own their error", copy.Message().As<QuotaError>() != quota && copy.Message().As<QuotaError>()->limit == 100);
+
+    Result config(0, ConfigError("missing listen address"));
+    Check("exceptions describe themselves with what()", config.Describe() == "missing listen address");
+    Check("messages are boxed as strings", Result(0, "timed out").Message().As<std::string>() != nullptr);
+    Check("an empty box is success", Parse(4).IsOk() && Parse(4).Message().Empty());
+
+    try {
+        static_cast<void>(config.Unwrap());
+        Check("Unwrap throws the description", false);
+    } catch (const std::runtime_error &e) {
+        Check("Unwrap throws the description", std::string(e.what()) == "missing listen address");
+    }
+    return resultpp::test::Finish();
+}
@@ -0,0 +1,86 @@
+#include <ErrorCode.hxx>
+
+#include <cerrno>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "allocations.hxx"
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// Results failing with std::error_code at the system call boundary: failed calls are wrapped, compared against
+// std::errc and by category without allocating, with the global allocation functions counting every call; the text of
+// an error is only rendered when it is asked for.
+namespace {
+    resultpp::SystemResult<int> Open(const char *path) {
+#if defined(__unix__) || defined(__APPLE__)
+        return resultpp::CheckSyscall(::open(path, O_RDONLY));
+#else
+        static_cast<void>(path);
+        return resultpp::ErrnoErr<int>(ENOENT);
+#endif
+    }
+
+    void Close(int fd) {
+#if defined(__unix__) || defined(__APPLE__)
+        ::close(fd);
+#else
+        static_cast<void>(fd);
+#endif
+    }
+}// namespace
+
+int main() {
+    const char *missing = "/resultpp/does/not/exist";
+
+    auto before = resultpp::test::Allocations();
+    int matched = 0;
+    for (int i = 0; i < 1000; ++i) {
+        auto fd = Open(missing).Map([](int value) { return value + 0; });
+        if (resultpp::ErrorIs(fd, std::errc::no_such_file_or_directory) && resultpp::ErrorIn(fd, std::system_category()))
+            ++matched;
+    }
+    Check("failed calls and comparisons allocate nothing", resultpp::test::Allocations() == before && matched == 1000);
+
+    auto fd = Open(missing);
+    Check("errno lands in the system category", fd.IsErr() && fd.Message().value() == ENOENT);
+    Check("exact comparison checks category and value",
+          resultpp::ErrorIs(fd, std::error_code(ENOENT, std::system_category())) &&
+                  !resultpp::ErrorIs(fd, std::error_code(ENOENT, std::generic_category())));
+    Check("the message is rendered on demand", fd.Describe().find(':') != std::string::npos);
+
+    auto timeout = resultpp::ErrcErr<int>(std::errc::timed_out);
+    Check("std::errc lands in the generic category",
+          resultpp::ErrorIn(timeout, std::generic_category()) && resultpp::ErrorIs(timeout, std::errc::timed_out));
+
+    errno = 0;
+    auto unset = resultpp::CheckSyscall(-1);
+    Check("a failure with errno unset is still an error",
+          unset.IsErr() && resultpp::ErrorIs(unset, std::errc::io_error) && resultpp::ErrnoErr<int>(0).IsErr());
+
+    auto ok = resultpp::SystemResult<int>(3);
+    Check("a zero code is success", ok.IsOk() && !resultpp::ErrorIs(ok, std::errc::timed_out));
+
+    try {
+        static_cast<void>(timeout.Unwrap());
+        Check("Unwrap throws the rendered message", false);
+    } catch (const std::runtime_error &e) {
+        Check("Unwrap throws the rendered message",
+              std::string(e.what()) == "generic: " + std::make_error_code(std::errc::timed_out).message());
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    auto self = Open(".");
+    Check("successful calls carry their value", self.IsOk() && self.Data() >= 0);
+    if (self.IsOk()) Close(self.Data());
+#endif
+    return resultpp::test::Finish();
+}
@@ -0,0 +1,109 @@
+#include <ErrorRegistry.hxx>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+#include "allocations.hxx"
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// Error codes that stay small integers in Results but print rich messages: a registered enum with sparse values,
+// looked up at compile time and at run time, with the global allocation functions counting every call to check that
+// describing a failure allocates nothing. A second registry of a thousand scattered codes checks that building the
+// table stays cheap for large, sparse enums.
+namespace {
+    enum class StoreError : std::uint16_t {
+        None = 0,
+        NotFound = 404,
+        Conflict = 409,
+        Timeout = 1'000,
+        DiskFull = 28'000,
+        Corrupt = 65'000,
+    };
+
+    enum class WideError : std::uint32_t { None };
+
+    constexpr std::size_t kWideCount = 1'024;
+
+    constexpr WideError Wide(std::size_t i) noexcept { return static_cast<WideError>((i + 1) * 4'000'037U); }
+}// namespace
+
+template<>
+struct resultpp::ErrorRegistry<StoreError> {
+    static constexpr std::string_view category = "store";
+    static constexpr ErrorEntry<StoreError> entries[] = {
+            {StoreError::NotFound, "key not found", ErrorSeverity::Info},
+            {StoreError::Conflict, "write conflict", ErrorSeverity::Warning},
+            {StoreError::Timeout, "replica did not answer in time", ErrorSeverity::Warning},
+            {StoreError::DiskFull, "no space left on the data volume"},
+            {StoreError::Corrupt, "page checksum mismatch", ErrorSeverity::Fatal},
+    };
+};
+
+template<>
+struct resultpp::ErrorRegistry<WideError> {
+    static constexpr std::string_view category = "wide";
+    static constexpr auto entries = [] {
+        std::array<ErrorEntry<WideError>, kWideCount> entries{};
+        for (std::size_t i = 0; i < kWideCount; ++i) {
+            entries[i] = {Wide(i), i % 2 == 0 ? "even" : "odd", i % 3 == 0 ? ErrorSeverity::Fatal : ErrorSeverity::Error};
+        }
+        return entries;
+    }();
+};
+
+static_assert(resultpp::ErrorMessage(StoreError::Conflict) == "write conflict");
+static_assert(resultpp::SeverityOf(StoreError::Corrupt) == resultpp::ErrorSeverity::Fatal);
+static_assert(resultpp::FindError(static_cast<StoreError>(7)) == nullptr);
+static_assert(resultpp::ErrorMessage(Wide(kWideCount - 1)) == "odd");
+
+namespace {
+    resultpp::Result<int, StoreError> Read(int key) {
+        if (key < 0) return resultpp::Result<int, StoreError>(0, StoreError::NotFound);
+        if (key > 1000) return resultpp::Result<int, StoreError>(0, StoreError::DiskFull);
+        return resultpp::Result<int, StoreError>(key * 2);
+    }
+}// namespace
+
+int main() {
+    auto before = resultpp::test::Allocations();
+    std::size_t length = 0;
+    for (int key = -100; key < 2000; ++key) {
+        auto result = Read(key);
+        if (result.IsErr()) length += result.Describe().size() + resultpp::CategoryOf(result.Message()).size();
+    }
+    Check("describing failures allocates nothing", resultpp::test::Allocations() == before && length > 0);
+
+    auto missing = Read(-1);
+    Check("Describe returns the registered message", missing.Describe() == "key not found");
+    Check("the code is still the error value", missing.Message() == StoreError::NotFound);
+    Check("severity and category come from the table",
+          resultpp::SeverityOf(missing.Message()) == resultpp::ErrorSeverity::Info &&
+                  resultpp::CategoryOf(missing.Message()) == "store");
+    Check("unregistered codes say so", resultpp::ErrorMessage(static_cast<StoreError>(410)) == "unregistered error");
+
+    try {
+        static_cast<void>(Read(5000).Unwrap());
+        Check("Unwrap throws the registered message", false);
+    } catch (const std::runtime_error &e) {
+        Check("Unwrap throws the registered message", std::string(e.what()) == "no space left on the data volume");
+    }
+
+    bool found = true;
+    for (std::size_t i = 0; i < kWideCount; ++i) {
+        const auto *entry = resultpp::FindError(Wide(i));
+        found = found && entry != nullptr && entry->code == Wide(i) &&
+                entry->severity == (i % 3 == 0 ? resultpp::ErrorSeverity::Fatal : resultpp::ErrorSeverity::Error);
+        found = found && resultpp::FindError(static_cast<WideError>(static_cast<std::uint32_t>(Wide(i)) + 1)) == nullptr;
+    }
+    Check("every code of a large sparse registry is found", found);
+
+    auto mapped = Read(3).Map([](int v) { return v + 1; });
+    Check("combinators keep working on registered codes", mapped.IsOk() && mapped.Data() == 7);
+    return resultpp::test::Finish();
+}
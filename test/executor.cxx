@@ -0,0 +1,102 @@
+#include <Executor.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "allocations.hxx"
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// The work-stealing Executor: exceptions turned into errors under ExceptionPolicy::ToErr, tasks stored without
+// allocating, work posted from a worker stolen by the others while that worker is busy, and queued work run by the
+// destructor.
+namespace {
+    using resultpp::internal::executor::Task;
+
+    void Spin(const std::atomic<int> &counter, int target) {
+        while (counter.load(std::memory_order_acquire) < target) std::this_thread::yield();
+    }
+}// namespace
+
+int main() {
+#if RESULTPP_HAS_ATOMIC_WAIT
+    {
+        resultpp::Executor pool(2, resultpp::ExceptionPolicy::ToErr);
+        auto thrown = pool.Submit([]() -> int { throw std::runtime_error("disk full"); }).Get();
+        Check("a throwing task completes with AsyncErrors::Exception(what)",
+              thrown.IsErr() && thrown.Message() == resultpp::AsyncErrors<std::string>::Exception("disk full"));
+
+        auto odd = pool.Submit([]() -> int { throw 42; }).Get();
+        Check("a non-std::exception throw is reported as unknown",
+              odd.IsErr() && odd.Message() == "resultpp: unknown exception");
+
+        auto fine = pool.Submit([] { return 7; }).Get();
+        Check("the workers survive and keep running tasks", fine.IsOk() && fine.Data() == 7);
+    }
+
+    {
+        std::uint64_t sink = 0;
+        auto *out = &sink;
+        std::uint64_t a = 3, b = 4;
+        auto multiply = [out, a, b] { *out += a * b; };
+        auto before = resultpp::test::Allocations();
+        Task small(multiply);
+        small();
+        Check("small trivially copyable captures are stored inline",
+              Task::IsInline<decltype(multiply)>() && resultpp::test::Allocations() == before && sink == 12);
+
+        std::string name(64, 'x');
+        before = resultpp::test::Allocations();
+        Task large([out, name = std::move(name)] { *out += name.size(); });
+        auto boxed = resultpp::test::Allocations() - before;
+        large();
+        Check("any other callable is moved to the heap", boxed == 1 && sink == 12 + 64);
+    }
+
+    {
+        constexpr int kChildren = 16;
+        resultpp::Executor pool(4);
+        std::atomic<int> done{0};
+        std::atomic<int> onParent{0};
+        pool.Submit([&] {
+                auto parent = std::this_thread::get_id();
+                for (int i = 0; i < kChildren; ++i) {
+                    pool.Post([&, parent] {
+                        if (std::this_thread::get_id() == parent) onParent.fetch_add(1);
+                        done.fetch_add(1, std::memory_order_release);
+                    });
+                }
+                // Busy until the children are done: none can be popped by this worker, so the others steal them.
+                Spin(done, kChildren);
+                return 0;
+            })
+                .Get();
+        Check("work posted from a busy worker is stolen by the others", done.load() == kChildren && onParent.load() == 0);
+    }
+
+    {
+        constexpr int kQueued = 1'000;
+        std::atomic<int> ran{0};
+        {
+            resultpp::Executor pool(1);
+            pool.Post([&ran] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                ran.fetch_add(1);
+            });
+            for (int i = 1; i < kQueued; ++i) pool.Post([&ran] { ran.fetch_add(1); });
+        }
+        Check("the destructor runs the work still queued", ran.load() == kQueued);
+    }
+    return resultpp::test::Finish();
+#else
+    return resultpp::test::Skip("std::atomic::wait is not available");
+#endif
+}
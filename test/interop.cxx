@@ -0,0 +1,108 @@
+#include <Interop.hxx>
+#include <resultpp.hxx>
+
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// Round-trips a payload through std::optional, std::variant and, when available, std::expected, counting copies and
+// moves of it: every conversion from an rvalue must move the payload and never copy it, and move-only payloads such as
+// std::unique_ptr must convert as well.
+namespace {
+    int copies = 0;
+    int moves = 0;
+
+    struct Tracked {
+        std::string bytes;
+
+        Tracked() = default;
+        explicit Tracked(std::string b) : bytes(std::move(b)) {}
+        Tracked(const Tracked &other) : bytes(other.bytes) { ++copies; }
+        Tracked(Tracked &&other) noexcept : bytes(std::move(other.bytes)) { ++moves; }
+        Tracked &operator=(const Tracked &other) {
+            bytes = other.bytes;
+            ++copies;
+            return *this;
+        }
+        Tracked &operator=(Tracked &&other) noexcept {
+            bytes = std::move(other.bytes);
+            ++moves;
+            return *this;
+        }
+    };
+
+    /**
+     * @brief Whether `convert` ran without copying a `Tracked` and moved at least one.
+     */
+    template<typename F>
+    bool MovesOnly(F &&convert) {
+        auto copiesBefore = copies, movesBefore = moves;
+        bool ok = convert();
+        return ok && copies == copiesBefore && moves > movesBefore;
+    }
+}// namespace
+
+int main() {
+    resultpp::Result<Tracked> result(Tracked(std::string(64, 'x')));
+    std::optional<Tracked> optional;
+    Check("Result -> std::optional", MovesOnly([&] {
+              optional = resultpp::ToOptional(std::move(result));
+              return optional.has_value() && optional->bytes.size() == 64;
+          }));
+
+    resultpp::Result<Tracked> fromOptional;
+    Check("std::optional -> Result", MovesOnly([&] {
+              fromOptional = resultpp::FromOptional(std::move(optional), std::string("empty"));
+              return fromOptional.IsOk() && fromOptional.Data().bytes.size() == 64;
+          }));
+
+    std::variant<Tracked, std::string> variant;
+    Check("Result -> std::variant", MovesOnly([&] {
+              variant = resultpp::ToVariant(std::move(fromOptional));
+              return variant.index() == 0;
+          }));
+
+    resultpp::Result<Tracked> fromVariant;
+    Check("std::variant -> Result", MovesOnly([&] {
+              fromVariant = std::move(variant);
+              return fromVariant.IsOk() && fromVariant.Data().bytes.size() == 64;
+          }));
+
+#if RESULTPP_HAS_EXPECTED
+    std::expected<Tracked, std::string> expected;
+    Check("Result -> std::expected", MovesOnly([&] {
+              expected = resultpp::ToExpected(std::move(fromVariant));
+              return expected.has_value() && expected->bytes.size() == 64;
+          }));
+
+    resultpp::Result<Tracked> fromExpected;
+    Check("std::expected -> Result", MovesOnly([&] {
+              fromExpected = resultpp::FromExpected(std::move(expected));
+              return fromExpected.IsOk() && fromExpected.Data().bytes.size() == 64;
+          }));
+
+    std::expected<Tracked, std::string> failed = std::unexpected(std::string("disk full"));
+    resultpp::Result<Tracked> err = std::move(failed);
+    Check("std::expected error -> Result", err.IsErr() && err.Message() == "disk full");
+#else
+    std::printf("std::expected is not available; its conversions are not checked\n");
+#endif
+    Check("no payload was copied", copies == 0);
+
+    resultpp::Result<std::unique_ptr<int>> owned(std::make_unique<int>(7));
+    auto ownedOptional = resultpp::ToOptional(std::move(owned));
+    auto ownedVariant = resultpp::ToVariant(resultpp::FromOptional(std::move(ownedOptional), std::string("empty")));
+    resultpp::Result<std::unique_ptr<int>> ownedBack = std::move(ownedVariant);
+#if RESULTPP_HAS_EXPECTED
+    ownedBack = resultpp::FromExpected(resultpp::ToExpected(std::move(ownedBack)));
+#endif
+    Check("std::unique_ptr round trip", ownedBack.IsOk() && *ownedBack.Data() == 7);
+    return resultpp::test::Finish();
+}
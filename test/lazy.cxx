@@ -0,0 +1,56 @@
+#include <resultpp.hxx>
+
+#include <cstdio>
+#include <string>
+
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// Lazy chains against the same chains run eagerly: Ok and Err sources through Map, FlatMap, MapErr, Or and OrElse,
+// including an Or whose fallback is 'Ok' and must resume the chain with its payload.
+namespace {
+    using Result = resultpp::Result<int>;
+
+    Result Half(int v) {
+        if (v % 2 != 0) return Result(0, std::string("odd"));
+        return Result(v / 2);
+    }
+
+    bool Same(const Result &a, const Result &b) {
+        return a.IsOk() == b.IsOk() && (a.IsOk() ? a.Data() == b.Data() : a.Message() == b.Message());
+    }
+}// namespace
+
+int main() {
+    for (int v : {4, 6, 3}) {
+        Result source(v);
+        auto eager = source.Map([](int x) { return x + 2; }).FlatMap(Half).Map([](int x) { return x * 10; });
+        auto lazy = source.Lazy().Map([](int x) { return x + 2; }).FlatMap(Half).Map([](int x) { return x * 10; }).Eval();
+        Check(("Map, FlatMap, Map from " + std::to_string(v)).c_str(), Same(eager, lazy));
+    }
+
+    auto okFallback = Result(0, std::string("bad")).Lazy().Map([](int x) { return x + 1; }).Or(Result(5)).Eval();
+    Check("Or with an Ok fallback resumes with its payload", okFallback.IsOk() && okFallback.Data() == 5);
+
+    auto continued = Result(3).Lazy().FlatMap(Half).Or(Result(8)).Map([](int x) { return x * 2; }).Eval();
+    Check("stages after Or run on the fallback's payload", continued.IsOk() && continued.Data() == 16);
+
+    auto errFallback = Result(0, std::string("bad")).Lazy().Or(Result(0, std::string("worse"))).Eval();
+    Check("Or with an Err fallback continues with its error", errFallback.IsErr() && errFallback.Message() == "worse");
+
+    auto recovered = Result(0, std::string("bad")).Lazy().Or(Result(0, std::string("worse"))).OrElse([](const std::string &) {
+        return Result(1);
+    }).Eval();
+    Check("and reaches the next error stage", recovered.IsOk() && recovered.Data() == 1);
+
+    auto skipped = Result(2).Lazy().Or(Result(9)).Map([](int x) { return x + 1; }).Eval();
+    Check("Or on an Ok chain keeps the chain's payload", skipped.IsOk() && skipped.Data() == 3);
+
+    Result failed(0, std::string("bad"));
+    Check("lazy Or agrees with eager Or", Same(failed.Lazy().Or(Result(7)).Eval(), failed.Or(Result(7))));
+
+    auto mapped = Result(0, std::string("bad")).Lazy().MapErr([](const std::string &m) { return m + "!"; }).Eval();
+    Check("MapErr", mapped.IsErr() && mapped.Message() == "bad!");
+    return resultpp::test::Finish();
+}
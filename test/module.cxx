@@ -0,0 +1,26 @@
+#include <resultpp.hxx>
+
+import resultpp;
+
+#include <string>
+
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// A translation unit that both includes resultpp.hxx and imports the resultpp module: the two must name the same
+// entities, so nothing below may be ambiguous, and deduction through the combinators must work across the import.
+int main() {
+    resultpp::Result<int> source(20);
+
+    auto doubled = source.Map([](int v) { return v * 2L; });
+    Check("Map deduces its payload type", doubled.IsOk() && doubled.Data() == 40L);
+
+    auto chained = source.Lazy().Map([](int v) { return v + 1; }).Eval();
+    Check("lazy chains evaluate", chained.IsOk() && chained.Data() == 21);
+
+    resultpp::internal::ResultImpl<int> failed(0, std::string("bad"));
+    auto fallback = failed.Or(resultpp::Result<int>(5));
+    Check("ResultImpl and Result are the same type", fallback.IsOk() && fallback.Data() == 5);
+    return resultpp::test::Finish();
+}
@@ -0,0 +1,142 @@
+#include <resultpp.hxx>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "check.hxx"
+
+// Runs the whole Result API over payloads with different value semantics: move-only (std::unique_ptr, a file
+// handle), copy-only (copies, no move operations), trivially copyable (int) and a movable buffer. The consuming
+// (`&&`) overloads are used for every payload; the copying (`const &`) ones only where the payload can be copied.
+namespace {
+    /**
+     * @brief Move-only owner of a file descriptor, standing in for handles that must never be duplicated.
+     */
+    class UniqueFd {
+        int _fd = -1;
+
+    public:
+        UniqueFd() = default;
+        explicit UniqueFd(int fd) : _fd(fd) {}
+        UniqueFd(UniqueFd &&other) noexcept : _fd(std::exchange(other._fd, -1)) {}
+        UniqueFd &operator=(UniqueFd &&other) noexcept {
+            _fd = std::exchange(other._fd, -1);
+            return *this;
+        }
+        UniqueFd(const UniqueFd &) = delete;
+        UniqueFd &operator=(const UniqueFd &) = delete;
+
+        [[nodiscard]] int Get() const noexcept { return _fd; }
+    };
+
+    /**
+     * @brief Type with user-declared copy operations and therefore no move operations; moves fall back to copies.
+     */
+    struct CopyOnly {
+        int value = 0;
+
+        CopyOnly() = default;
+        explicit CopyOnly(int v) : value(v) {}
+        CopyOnly(const CopyOnly &other) = default;
+        CopyOnly &operator=(const CopyOnly &other) = default;
+    };
+
+    void Check(const char *payload, const char *step, bool ok) {
+        resultpp::test::Check((std::string(payload) + ": " + step).c_str(), ok);
+    }
+
+    /**
+     * @brief Exercise the API with `make(i)` producing distinct payloads and `read` extracting a comparable value.
+     */
+    template<typename T, typename Make, typename Read>
+    void Exercise(const char *name, Make make, Read read) {
+        using R = resultpp::Result<T>;
+        auto ok = [&](int i) { return R(make(i)); };
+        auto err = [](const char *message) { return R(T{}, std::string(message)); };
+
+        // Construction, moves, swap and assignment.
+        R a = ok(1);
+        R b = std::move(a);
+        Check(name, "move construct", b.IsOk() && read(b.Data()) == 1);
+        a = ok(2);
+        std::swap(a, b);
+        Check(name, "swap", read(a.Data()) == 1 && read(b.Data()) == 2);
+        b << make(3);
+        Check(name, "operator<<", read(b.Data()) == 3);
+        b.SetData(make(4));
+        Check(name, "SetData", read(b.Data()) == 4);
+        b = std::string("failed");
+        Check(name, "assign message", b.IsErr() && b.Message() == "failed");
+
+        // Consuming combinators.
+        auto mapped = ok(5).Map([&](T &&v) { return read(v) * 10; });
+        Check(name, "Map &&", mapped.IsOk() && mapped.Data() == 50);
+        auto mappedErr = err("boom").Map([&](T &&v) { return read(v); });
+        Check(name, "Map && on Err", mappedErr.IsErr() && mappedErr.Message() == "boom");
+        auto kept = ok(6).Map([](T &&v) { return std::move(v); });
+        Check(name, "Map && to the same type", kept.IsOk() && read(kept.Data()) == 6);
+        auto flat = ok(7).FlatMap([&](T &&v) { return resultpp::Result<int>(read(v)); });
+        Check(name, "FlatMap &&", flat.IsOk() && flat.Data() == 7);
+        auto then = ok(8).AndThen([&](T &&v) { return read(v) + 1; });
+        Check(name, "AndThen &&", then.Data() == 9);
+        auto mapErr = err("x").MapErr([](std::string &&m) { return m + "y"; });
+        Check(name, "MapErr &&", mapErr.Message() == "xy");
+        auto mapErrOk = ok(9).MapErr([](std::string &&m) { return m; });
+        Check(name, "MapErr && on Ok", mapErrOk.IsOk() && read(mapErrOk.Data()) == 9);
+        auto orOk = ok(10).Or(err("other"));
+        Check(name, "Or &&", orOk.IsOk() && read(orOk.Data()) == 10);
+        auto fallback = err("x").Or(ok(16));
+        Check(name, "Or && takes an Ok fallback's payload", fallback.IsOk() && read(fallback.Data()) == 16);
+        auto bothErr = err("x").Or(err("other"));
+        Check(name, "Or && with an Err fallback", bothErr.IsErr() && bothErr.Message() == "other");
+        auto orElse = err("x").OrElse([&](std::string &&) { return R(make(11)); });
+        Check(name, "OrElse &&", orElse.IsOk() && read(orElse.Data()) == 11);
+        Check(name, "Unwrap &&", read(ok(12).Unwrap()) == 12);
+        Check(name, "Expect &&", read(ok(13).Expect("no value")) == 13);
+        T moved = ok(14).Data();
+        Check(name, "Data &&", read(moved) == 14);
+        bool threw = false;
+        try {
+            (void) err("unwrap").Unwrap();
+        } catch (const std::runtime_error &) { threw = true; }
+        Check(name, "Unwrap && on Err throws", threw);
+
+        // Copying combinators, for payloads that can be copied.
+        if constexpr (std::is_copy_constructible_v<T>) {
+            const R c = ok(15);
+            Check(name, "Map const &", c.Map([&](const T &v) { return read(v); }).Data() == 15);
+            Check(name, "FlatMap const &", c.FlatMap([&](const T &v) { return resultpp::Result<int>(read(v)); }).Data() == 15);
+            Check(name, "AndThen const &", c.AndThen([&](const T &v) { return read(v); }).Data() == 15);
+            Check(name, "MapErr const &", read(c.MapErr([](const std::string &m) { return m; }).Data()) == 15);
+            Check(name, "Or const &", read(c.Or(err("other")).Data()) == 15);
+            const R failed = err("x");
+            const R spare = ok(17);
+            Check(name, "Or const & takes an Ok fallback's payload", read(failed.Or(spare).Data()) == 17);
+            Check(name, "Or const & with a temporary fallback", read(failed.Or(ok(18)).Data()) == 18);
+            Check(name, "OrElse const &", read(c.OrElse([&](const std::string &) { return R(make(0)); }).Data()) == 15);
+            Check(name, "Unwrap const &", read(c.Unwrap()) == 15);
+            R copy = c;
+            Check(name, "copy construct", read(copy.Data()) == 15 && read(c.Data()) == 15);
+        }
+    }
+}// namespace
+
+int main() {
+    Exercise<std::unique_ptr<int>>(
+            "std::unique_ptr<int> (move-only)", [](int i) { return std::make_unique<int>(i); },
+            [](const std::unique_ptr<int> &p) { return p ? *p : -1; });
+    Exercise<UniqueFd>(
+            "UniqueFd (move-only)", [](int i) { return UniqueFd(i); }, [](const UniqueFd &fd) { return fd.Get(); });
+    Exercise<CopyOnly>(
+            "CopyOnly (copy-only)", [](int i) { return CopyOnly(i); }, [](const CopyOnly &c) { return c.value; });
+    Exercise<int>(
+            "int (trivially copyable)", [](int i) { return i; }, [](int v) { return v; });
+    Exercise<std::vector<int>>(
+            "std::vector<int> (buffer)", [](int i) { return std::vector<int>(64, i); },
+            [](const std::vector<int> &v) { return v.empty() ? -1 : v.front(); });
+    return resultpp::test::Finish();
+}
@@ -0,0 +1,118 @@
+#include <ResultFile.hxx>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// Writes a result file, reads it back through the mapping, then corrupts copies of it column by column: every
+// corruption that would send a lookup out of its column must be rejected by Open or Validate instead of read.
+namespace {
+    using Bytes = std::vector<char>;
+    using Header = resultpp::internal::columnar::FileHeader;
+
+    Bytes Load(const std::string &path) {
+        std::ifstream in(path, std::ios::binary);
+        return Bytes(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    void Store(const std::string &path, const Bytes &bytes) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    Header HeaderOf(const Bytes &bytes) {
+        Header header{};
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        return header;
+    }
+
+    template<typename V>
+    void Poke(Bytes &bytes, std::uint64_t offset, V value) { std::memcpy(bytes.data() + offset, &value, sizeof(value)); }
+
+    /**
+     * @brief Whether Open or Validate rejects `bytes` with an Err.
+     */
+    bool Rejected(const std::string &path, const Bytes &bytes) {
+        Store(path, bytes);
+        resultpp::ResultFile<int> file;
+        return file.Open(path).IsErr() || file.Validate().IsErr();
+    }
+}// namespace
+
+int main() {
+    auto path = (std::filesystem::temp_directory_path() / "resultpp_test.results").string();
+    auto corrupt = path + ".corrupt";
+
+    {
+        resultpp::ResultFileWriter<int> writer;
+        writer.Append(1);
+        writer.AppendErr("dropped");
+        Check("rows appended before Open are dropped", writer.Rows() == 0);
+        Check("finishing an unopened writer is an Err", writer.Finish().IsErr());
+    }
+
+    {
+        resultpp::ResultFileWriter<int> writer;
+        writer.Open(path).Unwrap();
+        for (int row = 0; row < 200; ++row) {
+            if (row % 7 == 3) writer.AppendErr(row % 2 == 0 ? "even failure" : "odd failure");
+            else writer.Append(row);
+        }
+        Check("writing succeeds", writer.Finish().IsOk());
+    }
+
+    {
+        resultpp::ResultFile<int> file;
+        auto rows = file.Open(path);
+        Check("a complete file opens", rows.IsOk() && rows.Data() == 200);
+        Check("payloads read back", file.IsOk(4) && file.Data(4) == 4);
+        Check("messages read back", file.Message(3) == "odd failure" && file.Message(10) == "even failure");
+        Check("Ok rows have no message", file.Message(5).empty());
+        Check("a complete file validates", file.Validate().IsOk());
+    }
+
+    auto good = Load(path);
+    auto header = HeaderOf(good);
+    Check("the file has errors and a dictionary", header.errors > 1 && header.dictionarySize == 2);
+
+    auto codes = good;
+    Poke<std::uint32_t>(codes, header.errorCodesOffset + 4, static_cast<std::uint32_t>(header.dictionarySize));
+    Check("an error code past the dictionary is rejected", Rejected(corrupt, codes));
+    {
+        resultpp::ResultFile<int> file;
+        Check("Open leaves the column scan to Validate", file.Open(corrupt).IsOk() && file.Validate().IsErr());
+    }
+
+    auto offsets = good;
+    Poke<std::uint64_t>(offsets, header.dictionaryOffset + 8, 1'000'000);
+    Check("decreasing dictionary offsets are rejected", Rejected(corrupt, offsets));
+
+    auto unordered = good;
+    Poke<std::uint64_t>(unordered, header.errorRowsOffset + 8, 0);
+    Check("error rows out of order are rejected", Rejected(corrupt, unordered));
+
+    auto missing = good;
+    Poke<std::uint64_t>(missing, header.bitmapOffset, 0);
+    Check("an Err bit without an error row is rejected", Rejected(corrupt, missing));
+
+    auto okRow = good;
+    Poke<std::uint64_t>(okRow, header.bitmapOffset, ~std::uint64_t{0});
+    Check("an error row whose bit says Ok is rejected", Rejected(corrupt, okRow));
+
+    auto truncated = good;
+    truncated.resize(truncated.size() - 1);
+    Check("a truncated file is rejected", Rejected(corrupt, truncated));
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(corrupt);
+    return resultpp::test::Finish();
+}
@@ -0,0 +1,73 @@
+#include <Serialization.hxx>
+#include <resultpp.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// Encodes Results into a byte buffer and parses them back, then asks for the encoding of a field longer than its
+// 32-bit length prefix: a serializer reporting a 4 GiB size stands in for it, so nothing that large is allocated.
+namespace {
+    struct Huge {
+        std::size_t size;
+    };
+}// namespace
+
+template<>
+struct resultpp::Serializer<Huge> {
+    static std::size_t Size(const Huge &value) noexcept { return value.size; }
+
+    static void Write(const Huge &, std::byte *) noexcept {}
+
+    static Huge Read(const std::byte *, std::size_t size) noexcept { return Huge{size}; }
+};
+
+int main() {
+    std::vector<std::byte> buffer;
+    auto ok = resultpp::Encode(resultpp::Result<std::string>("payload"), buffer);
+    auto err = resultpp::Encode(resultpp::Result<std::string>(std::string{}, "failed"), buffer);
+    Check("Encode returns the bytes appended", ok.IsOk() && err.IsOk() && ok.Data() + err.Data() == buffer.size());
+
+    auto first = resultpp::ResultView<std::string>::Parse(buffer.data(), buffer.size());
+    Check("the first record reads back", first.IsOk() && first.Data().IsOk() && first.Data().Data() == "payload");
+    const auto *next = buffer.data() + first.Data().Size();
+    auto second = resultpp::ResultView<std::string>::Parse(next, buffer.size() - first.Data().Size());
+    Check("the second record reads back",
+          second.IsOk() && second.Data().IsErr() && second.Data().Message() == "failed");
+    Check("a truncated record is rejected", resultpp::ResultView<std::string>::Parse(buffer.data(), 4).IsErr());
+    Check("the other side of a record reads as empty",
+          first.Data().Message().empty() && second.Data().Data().empty());
+
+    std::vector<std::byte> ints;
+    resultpp::Encode(resultpp::Result<int>(0, "failed"), ints).Unwrap();
+    Check("the payload of an Err record is value-initialised", resultpp::ResultView<int>(ints.data()).Data() == 0);
+
+    static_assert(resultpp::internal::wire::kPointerLike<const char *> &&
+                          resultpp::internal::wire::kPointerLike<std::string_view> &&
+                          resultpp::internal::wire::kPointerLike<std::error_code> &&
+                          !resultpp::internal::wire::kPointerLike<int>,
+                  "process-local types are refused as raw bytes");
+
+    if constexpr (sizeof(std::size_t) > sizeof(std::uint32_t)) {
+        using HugeResult = resultpp::Result<Huge>;
+        const std::size_t limit = 0xFFFF'FFFFU;
+        Check("a field at the length limit is encodable",
+              resultpp::EncodedSize(HugeResult(Huge{limit})).IsOk() &&
+                      resultpp::EncodedSize(HugeResult(Huge{limit})).Data() == 1 + 4 + limit);
+
+        auto size = resultpp::EncodedSize(HugeResult(Huge{limit + 1}));
+        Check("EncodedSize rejects a field past the length limit", size.IsErr());
+        auto before = buffer.size();
+        auto encoded = resultpp::Encode(HugeResult(Huge{limit + 1}), buffer);
+        Check("Encode rejects it and leaves the buffer alone", encoded.IsErr() && buffer.size() == before);
+    }
+    return resultpp::test::Finish();
+}
@@ -0,0 +1,130 @@
+#include <SharedResult.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// Many threads waiting on one expensive, fallible initialisation: exactly one runs it, the others block until it is
+// published and then read the same Result. Also covers a stored Err, a throwing initialiser and SharedResult handles.
+namespace {
+    constexpr int kThreads = 8;
+
+    /**
+     * @brief A payload whose copy throws when asked to.
+     */
+    struct Fragile {
+        bool fail = false;
+
+        Fragile() = default;
+        explicit Fragile(bool f) : fail(f) {}
+        Fragile(Fragile &&) noexcept = default;
+        Fragile(const Fragile &other) : fail(other.fail) {
+            if (fail) throw std::runtime_error("copy failed");
+        }
+    };
+
+    /**
+     * @brief Run `body(i)` on `kThreads` threads released together.
+     */
+    template<typename F>
+    void RunThreads(F body) {
+        std::atomic<bool> go{false};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < kThreads; ++i) {
+            threads.emplace_back([&, i] {
+                while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+                body(i);
+            });
+        }
+        go.store(true, std::memory_order_release);
+        for (auto &thread : threads) thread.join();
+    }
+}// namespace
+
+int main() {
+#if RESULTPP_HAS_ATOMIC_WAIT
+    using Model = std::vector<float>;
+
+    {
+        resultpp::OnceResult<Model> model;
+        std::atomic<int> loads{0};
+        std::atomic<int> sameObject{0};
+        RunThreads([&](int) {
+            const auto &result = model.GetOrInit([&] {
+                loads.fetch_add(1);
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                return resultpp::Result<Model>(Model(1024, 0.5f));
+            });
+            if (&result == model.TryGet() && result.IsOk() && result.Data().size() == 1024) sameObject.fetch_add(1);
+        });
+        Check("GetOrInit runs the initialiser once", loads.load() == 1);
+        Check("every thread reads the published Result", sameObject.load() == kThreads);
+    }
+
+    {
+        resultpp::OnceResult<int> shard;
+        std::atomic<int> errs{0};
+        RunThreads([&](int i) {
+            if (i == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                shard.Set(resultpp::Result<int>(0, std::string("shard 3 is offline")));
+            }
+            if (shard.Get().IsErr() && shard.Get().Message() == "shard 3 is offline") errs.fetch_add(1);
+        });
+        Check("Get blocks until Set, and an Err is shared", errs.load() == kThreads);
+        Check("Set on a filled cell is refused", !shard.Set(resultpp::Result<int>(42)));
+    }
+
+    {
+        resultpp::OnceResult<int> flaky;
+        std::atomic<int> attempts{0};
+        std::atomic<int> threw{0};
+        std::atomic<int> values{0};
+        RunThreads([&](int) {
+            try {
+                const auto &result = flaky.GetOrInit([&]() -> resultpp::Result<int> {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                    if (attempts.fetch_add(1) == 0) throw std::runtime_error("transient");
+                    return resultpp::Result<int>(7);
+                });
+                if (result.Data() == 7) values.fetch_add(1);
+            } catch (const std::runtime_error &) { threw.fetch_add(1); }
+        });
+        Check("a throwing initialiser leaves the cell empty", attempts.load() == 2 && threw.load() == 1);
+        Check("the next caller initialises it", values.load() == kThreads - 1);
+    }
+
+    {
+        resultpp::OnceResult<Fragile> cell;
+        const resultpp::Result<Fragile> broken(Fragile(true));
+        bool threw = false;
+        try {
+            cell.Set(broken);
+        } catch (const std::runtime_error &) { threw = true; }
+        Check("a throwing Set leaves the cell empty", threw && !cell.IsReady());
+
+        std::thread waiter([&] { static_cast<void>(cell.Get()); });
+        Check("the next Set fills it", cell.Set(resultpp::Result<Fragile>(Fragile(false))));
+        waiter.join();
+        Check("and releases the waiters", cell.IsReady() && !cell.Get().Data().fail);
+    }
+
+    {
+        resultpp::SharedResult<std::string> config;
+        auto reader = config;
+        config.Set(resultpp::Result<std::string>(std::string("threads=8")));
+        Check("SharedResult handles share one cell", reader.IsReady() && reader.Get().Data() == "threads=8");
+    }
+    return resultpp::test::Finish();
+#else
+    return resultpp::test::Skip("std::atomic::wait is not available");
+#endif
+}
@@ -0,0 +1,48 @@
+#include <TaskGraph.hxx>
+
+#include <cstdio>
+#include <string>
+
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// A small batch job as a TaskGraph: load, then two independent transforms, then a join. One branch fails, and every
+// node downstream of it is skipped with the failing node's error while the independent branch still runs.
+int main() {
+#if RESULTPP_HAS_ATOMIC_WAIT
+    using resultpp::Result;
+
+    resultpp::Executor pool(4);
+    resultpp::TaskGraph<> job;
+
+    auto load = job.Add([] { return std::string("3,1,2"); });
+    auto count = job.Add([](const std::string &csv) { return static_cast<int>(csv.size() + 1) / 2; }, load);
+    auto checksum = job.Add([](const std::string &csv) {
+        int sum = 0;
+        for (char c : csv) sum += c == ',' ? 0 : c - '0';
+        return sum;
+    }, load);
+    auto report = job.Add([](const int &n, const int &sum) { return std::to_string(sum) + "/" + std::to_string(n); }, count, checksum);
+
+    auto validate = job.Add([](const std::string &csv) {
+        return csv.find('0') == std::string::npos ? Result<bool>(false, std::string("no sentinel row"))
+                                                  : Result<bool>(true);
+    }, load);
+    auto publish = job.Add([](const bool &, const std::string &text) { return text; }, validate, report);
+    auto archive = job.Add([](const std::string &text) { return text.size(); }, publish);
+
+    auto summary = job.Run(pool);
+    Check("independent branches run", job.Get(report).IsOk() && job.Get(report).Data() == "6/3");
+    Check("the failing node holds its error", job.Status(validate) == resultpp::NodeStatus::Failed);
+    Check("its dependents are skipped with that error",
+          job.Status(publish) == resultpp::NodeStatus::Skipped && job.Get(archive).Message() == "no sentinel row");
+    Check("the summary counts every outcome", summary.ok == 4 && summary.failed == 1 && summary.skipped == 2);
+
+    auto again = job.Run(pool);
+    Check("a graph can run again", again.ok == summary.ok && job.Get(report).Data() == "6/3");
+    return resultpp::test::Finish();
+#else
+    return resultpp::test::Skip("std::atomic::wait is not available");
+#endif
+}
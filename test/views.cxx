@@ -0,0 +1,92 @@
+#include <Views.hxx>
+
+#include <cstdio>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "allocations.hxx"
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// Filters and projects a vector of Results with resultpp::views inside std::views pipelines, and checks that
+// filtering allocates nothing: the global allocation functions count every call while the pipelines run. Filtering
+// the output of transform_ok must call the function once per element, not once to test it and again to read it.
+namespace {
+    resultpp::Result<int> Parse(const std::string &text) {
+        if (text.empty() || text.size() > 9 || text.find_first_not_of("0123456789") != std::string::npos)
+            return resultpp::Result<int>(0, "not a number: '" + text + "'");
+        return resultpp::Result<int>(std::stoi(text));
+    }
+}// namespace
+
+int main() {
+#if RESULTPP_HAS_RANGES
+    using resultpp::Result;
+    namespace views = resultpp::views;
+
+    std::vector<std::string> lines{"12", "x7", "40", "", "1000000000000", "5"};
+    std::vector<Result<std::string>> read;
+    for (const auto &line : lines) {
+        if (line.empty()) read.emplace_back(std::string{}, std::string("empty line"));
+        else read.emplace_back(line);
+    }
+    std::vector<Result<int>> parsed;
+    for (const auto &line : lines) parsed.push_back(Parse(line));
+
+    auto before = resultpp::test::Allocations();
+
+    int sum = 0;
+    for (const int &value : parsed | views::ok_values) sum += value;
+    Check("ok_values", sum == 12 + 40 + 5);
+
+    const int *first = nullptr;
+    for (const int &value : parsed | views::ok_values | std::views::take(1)) first = &value;
+    Check("ok_values refers into the vector", first == &parsed[0].Data());
+
+    std::size_t errors = 0;
+    bool firstError = false;
+    for (const std::string &error : parsed | views::errors) {
+        if (errors++ == 0) firstError = error == "not a number: 'x7'";
+    }
+    Check("errors", errors == 3 && firstError);
+
+    int doubled = 0;
+    for (int value : parsed | views::ok_values | std::views::transform([](int v) { return v * 2; })) doubled += value;
+    Check("ok_values | std::views::transform", doubled == 2 * (12 + 40 + 5));
+    Check("no allocation while filtering", resultpp::test::Allocations() == before);
+
+    std::size_t lengths = 0;
+    for (const auto &length : read | views::transform_ok([](const std::string &s) { return s.size(); }) | views::ok_values) {
+        lengths += length;
+    }
+    Check("transform_ok with a plain function", lengths == 2 + 2 + 2 + 13 + 1);
+
+    auto fallible = parsed | views::transform_ok([](int v) {
+                        if (v > 20) return Result<int>(0, std::string("too large"));
+                        return Result<int>(v + 1);
+                    });
+    int small = 0;
+    std::size_t failed = 0;
+    for (int value : fallible | views::ok_values) small += value;
+    for (const auto &result : fallible) failed += result.IsErr();
+    Check("transform_ok with a fallible function", small == 13 + 6 && failed == 4);
+
+    int calls = 0;
+    auto counted = parsed | views::transform_ok([&calls](int v) {
+                       ++calls;
+                       return v;
+                   });
+    int total = 0;
+    for (int value : counted | views::ok_values) total += value;
+    Check("ok_values reads each transformed element once", total == 12 + 40 + 5 && calls == 3);
+    calls = 0;
+    std::size_t described = 0;
+    for (const auto &error : counted | views::errors) described += !error.empty();
+    Check("errors reads each transformed element once", described == 3 && calls == 3);
+    return resultpp::test::Finish();
+#else
+    return resultpp::test::Skip("std::ranges is not available");
+#endif
+}
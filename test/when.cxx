@@ -0,0 +1,118 @@
+#include <When.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "check.hxx"
+
+using resultpp::test::Check;
+
+// Fans work out to threads and joins it with WhenAll and WhenAny: the happy path, the first error winning while the
+// siblings observe cancellation through their token, the range forms, and the first success winning a race.
+namespace {
+    std::vector<std::thread> workers;
+
+    /**
+     * @brief Run `body()` on a new thread and return the future of its Result; the threads are joined by `Join`.
+     */
+    template<typename T, typename F>
+    resultpp::ResultFuture<T> Spawn(F body) {
+        resultpp::ResultPromise<T> promise;
+        auto future = promise.GetFuture();
+        workers.emplace_back([promise = std::move(promise), body]() mutable { promise.Set(body()); });
+        return future;
+    }
+
+    void Join() {
+        for (auto &worker : workers) worker.join();
+        workers.clear();
+    }
+
+    /**
+     * @brief A slow step that gives up as soon as `token` is cancelled.
+     */
+    resultpp::Result<int> Slow(const resultpp::CancellationToken &token, int value) {
+        for (int i = 0; i < 200; ++i) {
+            if (token.IsCancelled()) return resultpp::Result<int>(0, std::string("cancelled"));
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return resultpp::Result<int>(value);
+    }
+}// namespace
+
+int main() {
+#if RESULTPP_HAS_ATOMIC_WAIT
+    using resultpp::Result;
+
+    {
+        auto all = resultpp::WhenAll(Spawn<int>([] { return Result<int>(6); }),
+                                     Spawn<std::string>([] { return Result<std::string>(std::string("seven")); }),
+                                     Spawn<double>([] { return Result<double>(8.5); }));
+        auto result = std::move(all).Get();
+        Check("WhenAll gathers every payload", result.IsOk() && result.Data() == std::make_tuple(6, std::string("seven"), 8.5));
+        Join();
+    }
+
+    {
+        resultpp::CancellationSource source;
+        auto token = source.Token();
+        std::atomic<int> stopped{0};
+        auto slow = [&] {
+            auto result = Slow(token, 1);
+            if (result.IsErr()) stopped.fetch_add(1);
+            return result;
+        };
+        auto start = std::chrono::steady_clock::now();
+        auto all = resultpp::WhenAll(source, Spawn<int>(slow), Spawn<int>([] { return Result<int>(0, std::string("disk full")); }),
+                                     Spawn<int>(slow));
+        auto result = std::move(all).Get();
+        Join();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        Check("WhenAll settles with the first error", result.IsErr() && result.Message() == "disk full");
+        Check("the siblings observe the cancellation", source.IsCancelled() && stopped.load() == 2);
+        Check("and stop early", elapsed < std::chrono::milliseconds(150));
+    }
+
+    {
+        std::vector<resultpp::ResultFuture<int>> parts;
+        for (int i = 0; i < 16; ++i) parts.push_back(Spawn<int>([i] { return Result<int>(i * i); }));
+        auto result = resultpp::WhenAll(parts).Get();
+        bool ordered = result.IsOk() && result.Data().size() == 16;
+        for (int i = 0; ordered && i < 16; ++i) ordered = result.Data()[i] == i * i;
+        Check("range WhenAll keeps the input order", ordered);
+        Join();
+
+        std::vector<resultpp::ResultFuture<int>> none;
+        Check("WhenAll over nothing is a ready Ok", resultpp::WhenAll(none).Get().IsOk());
+    }
+
+    {
+        resultpp::CancellationSource source;
+        auto token = source.Token();
+        std::vector<resultpp::ResultFuture<int>> replicas;
+        replicas.push_back(Spawn<int>([token] { return Slow(token, 1); }));
+        replicas.push_back(Spawn<int>([] { return Result<int>(0, std::string("replica 2 unreachable")); }));
+        replicas.push_back(Spawn<int>([] { return Result<int>(3); }));
+        auto result = resultpp::WhenAny(replicas, source).Get();
+        Join();
+        Check("WhenAny takes the first success", result.IsOk() && result.Data() == 3);
+        Check("and cancels the losers", source.IsCancelled());
+    }
+
+    {
+        auto any = resultpp::WhenAny(Spawn<int>([] { return Result<int>(0, std::string("a failed")); }),
+                                     Spawn<int>([] { return Result<int>(0, std::string("b failed")); }));
+        auto result = std::move(any).Get();
+        Join();
+        Check("WhenAny fails only when every input fails", result.IsErr() && result.Message().find("failed") != std::string::npos);
+    }
+    return resultpp::test::Finish();
+#else
+    return resultpp::test::Skip("std::atomic::wait is not available");
+#endif
+}